@@ -2,11 +2,12 @@
 ///
 /// @file Z2integer.h
 ///
-/// This file contains classes and functions related to Z2integer.
+/// This file contains classes and functions related to the coefficients
+/// of chains: the field Z_2 (GF2) and the fields Z_p for odd primes p.
 ///
 /// Most of this file is inherited from the CHomP library:written by Pawel Pilarczyk.
 /// http://chomp.rutgers.edu/Projects/Computational_Homology/OriginalCHomP/software/
-/// Class Z2integer is from 'integer.h'.
+/// Class Zp is from 'integer.h'.
 /////////////////////////////////////////////////////////////////////////////
 
 // Copyright (C) 1997-2013 by Pawel Pilarczyk.
@@ -28,65 +29,231 @@
 // MA 02111-1307, USA.
 // Started in 2015. Last revision: January 29, 2016.
 
-
+#ifndef Z2INTEGER_H
+#define Z2INTEGER_H
 
 #include <iostream>
 
 // classes defined in this module (in this order):
-class Z2integer;
+class GF2;
+template <int p> class Zp;
+
+// --------------------------------------------------
+// ---------------------- GF2 -----------------------
+// --------------------------------------------------
+
+/// The field Z_2. The addition is "xor" and the multiplication is "and".
+/// Chains over this field keep no coefficients at all (see chain.h).
+class GF2{
+public:
+  // assignment operator(s)
+  GF2 &operator = (int n);
+  // initialize the integers:
+  static int initialize ();
+  explicit GF2 (int n = 0);
+  // the characteristic of the field
+  static int characteristic ();
+  // the function "delta": equal to 0 on 0,
+  // equal to 1 on invertibles, otherwise > 1
+  int delta (void) const;
+
+  // a normalized number (a better representant for homology)
+  GF2 normalized () const;
+  // several operators
+  GF2 operator - () const;
+  GF2 &operator += (const GF2 &n);
+  GF2 &operator *= (const GF2 &n);
+  GF2 operator + (const GF2 &n) const;
+  GF2 operator * (const GF2 &n) const;
+  GF2 operator / (const GF2 &n) const;
+  GF2 operator % (const GF2 &n) const;
+  int operator == (const GF2 &n) const;
+  friend std::ostream &operator << (std::ostream &out, const GF2 &n);
+  friend bool operator < (const GF2 &x, const GF2 &y);
+  friend bool operator > (const GF2 &x, const GF2 &y);
+ protected:
+  // the bit: 0 or 1
+  unsigned char num;
+}; /* class GF2 */
+
+// --------------------------------------------------
+
+inline GF2::GF2 (int n): num ((unsigned char) (n & 1))
+{
+	return;
+} /* GF2::GF2 */
+
+inline GF2 &GF2::operator = (int n)
+{
+	num = (unsigned char) (n & 1);
+	return *this;
+} /* GF2::operator = */
+
+inline int GF2::initialize ()
+{
+	return 2;
+} /* GF2::initialize */
+
+inline int GF2::characteristic ()
+{
+	return 2;
+} /* GF2::characteristic */
+
+inline int GF2::delta (void) const
+{
+	return num;
+} /* GF2::delta */
+
+inline GF2 GF2::normalized (void) const
+{
+	return *this;
+} /* GF2::normalized */
+
+inline GF2 GF2::operator - () const
+{
+	return *this;
+} /* GF2::operator - (unary) */
+
+inline GF2 &GF2::operator += (const GF2 &n)
+{
+	num ^= n. num;
+	return *this;
+} /* GF2::operator += */
+
+inline GF2 &GF2::operator *= (const GF2 &n)
+{
+	num &= n. num;
+	return *this;
+} /* GF2::operator *= */
+
+inline GF2 GF2::operator + (const GF2 &n) const
+{
+	return GF2 (num ^ n. num);
+} /* operator + */
+
+inline GF2 GF2::operator * (const GF2 &n) const
+{
+	return GF2 (num & n. num);
+} /* operator * */
+
+inline GF2 GF2::operator / (const GF2 &) const
+{
+	// the only invertible element is 1
+	return *this;
+} /* GF2::operator / */
+
+inline GF2 GF2::operator % (const GF2 &) const
+{
+	return GF2 (0);
+} /* operator % */
+
+inline int GF2::operator == (const GF2 &n) const
+{
+	return (n. num == num);
+} /* operator == */
+
+inline std::ostream &operator << (std::ostream &out, const GF2 &n)
+{
+	out << (long) n. num;
+	return out;
+} /* operator << */
+
+inline std::istream &operator >> (std::istream &in, GF2 &n)
+{
+	long number;
+	in >> number;
+	if (!in)
+		return in;
+	n = (int) (number & 1);
+	return in;
+} /* operator >> */
+
+inline int operator != (const GF2 &n, const GF2 &m)
+{
+	return (!(n == m));
+} /* operator != */
 
-class Z2integer{
+inline int operator == (const GF2 &n, int m)
+{
+	return (n == GF2 (m));
+} /* operator == */
+
+inline int operator != (const GF2 &n, int m)
+{
+	return !(n == m);
+} /* operator != */
+
+inline GF2 operator - (const GF2 &n, const GF2 &m)
+{
+	return (n + m);
+} /* operator - */
+
+inline bool operator < (const GF2 &x, const GF2 &y)
+{
+	return (x. num < y. num);
+} /* operator < */
+
+inline bool operator > (const GF2 &x, const GF2 &y)
+{
+	return (x. num > y. num);
+} /* operator > */
+
+// --------------------------------------------------
+// ---------------------- Zp ------------------------
+// --------------------------------------------------
+
+/// The field Z_p for a prime number p; used for odd primes,
+/// as GF2 is the faster version of Zp<2>.
+template <int p>
+class Zp{
 public:
   // assignment operator(s)
-  Z2integer &operator = (int n);
+  Zp &operator = (int n);
   // initialize the integers:
   static int initialize ();
-  explicit Z2integer (int n = 0);
+  explicit Zp (int n = 0);
+  // the characteristic of the field
+  static int characteristic ();
   // the function "delta": equal to 0 on 0,
   // equal to 1 on invertibles, otherwise > 1
   int delta (void) const;
 
   // a normalized number (a better representant for homology)
-  Z2integer normalized () const;
+  Zp normalized () const;
   // several operators
-  Z2integer operator - () const;
-  Z2integer &operator += (const Z2integer &n);
-  Z2integer &operator *= (const Z2integer &n);
-  Z2integer operator + (const Z2integer &n) const;
-  Z2integer operator * (const Z2integer &n) const;
-  Z2integer operator / (const Z2integer &n) const;
-  Z2integer operator % (const Z2integer &n) const;
-  int operator == (const Z2integer &n) const;
-  friend std::ostream &operator << (std::ostream &out, const Z2integer &n);
-  friend bool operator < (const Z2integer &x, const Z2integer &y);
-  friend bool operator > (const Z2integer &x, const Z2integer &y);
+  Zp operator - () const;
+  Zp &operator += (const Zp &n);
+  Zp &operator *= (const Zp &n);
+  Zp operator + (const Zp &n) const;
+  Zp operator * (const Zp &n) const;
+  Zp operator / (const Zp &n) const;
+  Zp operator % (const Zp &n) const;
+  int operator == (const Zp &n) const;
+  template <int q>
+  friend std::ostream &operator << (std::ostream &out, const Zp<q> &n);
+  template <int q>
+  friend bool operator < (const Zp<q> &x, const Zp<q> &y);
+  template <int q>
+  friend bool operator > (const Zp<q> &x, const Zp<q> &y);
  protected:
-  // mod2
-  static const int p = 2;
-  // the integer number
+  // the integer number in 0, ..., p-1
   signed short num;
   // various additional procedures
   static int cut_down (int n);
   static unsigned invert (unsigned n, unsigned q);
-}; /* class Z2integer */
+}; /* class Zp */
 
 // --------------------------------------------------
 
- inline Z2integer::Z2integer (int n)
+template <int p>
+inline Zp<p>::Zp (int n)
 {
-	if (p)
-		num = (signed short) cut_down (n);
-	else
-	{
-		num = (signed short) n;
-		if ((long) num != (long) n)
-			throw "Number out of range at initialization.";
-	}
+	num = (signed short) cut_down (n);
 	return;
-}  /* integer::integer */
+}  /* Zp::Zp */
 
-
-inline int Z2integer::cut_down (int n)
+template <int p>
+inline int Zp<p>::cut_down (int n)
 {
 	if (n >= 0)
 		if (n < p)
@@ -103,181 +270,187 @@ inline int Z2integer::cut_down (int n)
 	}
 } /* cut_down */
 
-
-inline Z2integer &Z2integer::operator = (int n)
+template <int p>
+inline unsigned Zp<p>::invert (unsigned n, unsigned q)
 {
-	if (p)
-		num = (signed short) cut_down (n);
-	else
+	// the extended Euclidean algorithm
+	int a = n, b = q, x = 1, y = 0;
+	while (b)
 	{
-		num = (unsigned short) n;
-		if ((long) num != (long) n)
-			throw "Number out of range at assignment.";
+		int quotient = a / b;
+		int tmp = a - quotient * b;
+		a = b;
+		b = tmp;
+		tmp = x - quotient * y;
+		x = y;
+		y = tmp;
 	}
+	if (a != 1)
+		throw "Trying to invert a non-invertible element.";
+	return (unsigned) cut_down (x);
+} /* Zp::invert */
+
+template <int p>
+inline Zp<p> &Zp<p>::operator = (int n)
+{
+	num = (signed short) cut_down (n);
 	return *this;
-} /* Z2integer::operator = */
+} /* Zp::operator = */
 
-inline Z2integer Z2integer::operator / (const Z2integer &n) const
+template <int p>
+inline Zp<p> Zp<p>::operator / (const Zp<p> &n) const
 {
-	Z2integer result;
-	if (p)
-		result = num * (int) invert (n. num, p);
-	else
-		result. num = (unsigned short) (num / n. num);
+	Zp<p> result;
+	result = num * (int) invert (n. num, p);
 	return result;
-} /* Z2integer::operator / */
+} /* Zp::operator / */
 
-inline Z2integer Z2integer::operator % (const Z2integer &n) const
+template <int p>
+inline Zp<p> Zp<p>::operator % (const Zp<p> &) const
 {
-	Z2integer result;
-	if (p)
-		result. num = 0;
-	else
-		result = num % n. num;
-	return result;
+	return Zp<p> (0);
 } /* operator % */
 
-inline Z2integer Z2integer::operator - () const
+template <int p>
+inline Zp<p> Zp<p>::operator - () const
 {
-	if (p)
-	{
-		Z2integer negative;
-		negative. num = (unsigned short) (p - num);
-		return negative;
-	}
-	else
-	{
-		unsigned short result = (unsigned short) -num;
-		if ((long) result + (long) num != 0)
-			throw "Number out of range (unary -).";
-		Z2integer intresult;
-		intresult = result;
-		return intresult;
-	}
-} /* Z2integer::operator - (unary) */
+	Zp<p> negative;
+	negative. num = (signed short) (num ? p - num : 0);
+	return negative;
+} /* Zp::operator - (unary) */
 
-inline Z2integer &Z2integer::operator += (const Z2integer &n)
+template <int p>
+inline Zp<p> &Zp<p>::operator += (const Zp<p> &n)
 {
-	if (!p)
-		if (((n. num >= 0) && (num + n. num < num)) ||
-			((n. num < 0) && (num + n. num > num)))
-			throw "Number out of range (+).";
 	num += n. num;
-	if (p)
-		if (num >= p)
-			num -= (unsigned short) p;
+	if (num >= p)
+		num -= (signed short) p;
 	return *this;
-} /* Z2integer::operator += */
+} /* Zp::operator += */
 
-inline Z2integer &Z2integer::operator *= (const Z2integer &n)
+template <int p>
+inline Zp<p> &Zp<p>::operator *= (const Zp<p> &n)
 {
-	if (p)
-	{
-		long result = (long) num * (long) n. num;
-		if (result >= 0)
-			num = (unsigned short) (result % p);
-		else
-		{
-			num = (unsigned short) (p - ((-result) % p));
-			if (num == p)
-				num = 0;
-		}
-	}
-	else
-	{
-		long result = (long) num * (long) (n. num);
-		num = (unsigned short) result;
-		if ((long) num != result)
-			throw "Number out of range (*).";
-	}
+	num = (signed short) (((int) num * (int) n. num) % p);
 	return *this;
-} /* Z2integer::operator *= */
+} /* Zp::operator *= */
 
-inline Z2integer Z2integer::operator + (const Z2integer &n) const
+template <int p>
+inline Zp<p> Zp<p>::operator + (const Zp<p> &n) const
 {
-	Z2integer m (n);
+	Zp<p> m (n);
 	m += *this;
 	return m;
 } /* operator + */
 
-inline Z2integer Z2integer::operator * (const Z2integer &n) const
+template <int p>
+inline Zp<p> Zp<p>::operator * (const Zp<p> &n) const
 {
-	Z2integer m (n);
+	Zp<p> m (n);
 	m *= *this;
 	return m;
 } /* operator * */
 
-inline int Z2integer::operator == (const Z2integer &n) const
+template <int p>
+inline int Zp<p>::operator == (const Zp<p> &n) const
 {
 	return (n. num == num);
 } /* operator == */
 
-inline std::ostream &operator << (std::ostream &out, const Z2integer &n)
+template <int p>
+inline std::ostream &operator << (std::ostream &out, const Zp<p> &n)
 {
 	out << (long) n. num;
 	return out;
 } /* operator << */
 
-inline std::istream &operator >> (std::istream &in, Z2integer &n)
+template <int p>
+inline std::istream &operator >> (std::istream &in, Zp<p> &n)
 {
 	long number;
 	in >> number;
 	if (!in)
 		return in;
-	n = number;
+	n = (int) (number % p);
 	return in;
 } /* operator >> */
 
-inline int operator != (const Z2integer &n, const Z2integer &m)
+template <int p>
+inline int operator != (const Zp<p> &n, const Zp<p> &m)
 {
 	return (!(n == m));
 } /* operator != */
 
-inline int operator == (const Z2integer &n, int m)
+template <int p>
+inline int operator == (const Zp<p> &n, int m)
 {
-	Z2integer intm;
-	intm = m;
-	return (n == intm);
+	return (n == Zp<p> (m));
 } /* operator == */
 
-inline int operator != (const Z2integer &n, int m)
+template <int p>
+inline int operator != (const Zp<p> &n, int m)
 {
 	return !(n == m);
 } /* operator != */
 
-inline Z2integer operator - (const Z2integer &n, const Z2integer &m)
+template <int p>
+inline Zp<p> operator - (const Zp<p> &n, const Zp<p> &m)
 {
 	return (n + -m);
 } /* operator - */
 
-inline int Z2integer::initialize ()
-{	return 2;
-} /* Z2integer::initialize */
+template <int p>
+inline int Zp<p>::initialize ()
+{
+	return p;
+} /* Zp::initialize */
 
-inline int Z2integer::delta (void) const
+template <int p>
+inline int Zp<p>::characteristic ()
 {
-	if (p)
-		return (num ? 1 : 0);
-	else
-		return ((num >= 0) ? num : -num);
-} /* Z2integer::delta */
+	return p;
+} /* Zp::characteristic */
 
-inline Z2integer Z2integer::normalized (void) const
+template <int p>
+inline int Zp<p>::delta (void) const
 {
-	Z2integer n;
-	if (num < 0)
-		n. num = (signed short) (-num);
-	else
-		n. num = num;
-	return n;
-} /* Z2integer::normalized */
+	return (num ? 1 : 0);
+} /* Zp::delta */
+
+template <int p>
+inline Zp<p> Zp<p>::normalized (void) const
+{
+	return *this;
+} /* Zp::normalized */
 
-inline bool operator < (const Z2integer &x, const Z2integer &y)
+template <int p>
+inline bool operator < (const Zp<p> &x, const Zp<p> &y)
 {
 	return (x. num < y. num);
 } /* operator < */
 
-inline bool operator > (const Z2integer &x, const Z2integer &y)
+template <int p>
+inline bool operator > (const Zp<p> &x, const Zp<p> &y)
 {
 	return (x. num > y. num);
 } /* operator > */
+
+// --------------------------------------------------
+
+/// The coefficients of the Z_2 homology and the whitney classes.
+typedef GF2 Z2integer;
+
+/// True for the field Z_2, whose signs and coefficients are trivial.
+template <class euclidom>
+struct isGF2
+{
+	static const bool value = false;
+};
+
+template <>
+struct isGF2<GF2>
+{
+	static const bool value = true;
+};
+
+#endif
@@ -6,7 +6,7 @@
 ///
 /// Most of this file is inherited from the CHomP library:written by Pawel Pilarczyk.
 /// http://chomp.rutgers.edu/Projects/Computational_Homology/OriginalCHomP/software/
-/// Classes Z2matrix and simplelist are from 'chain.h'.the class auto_array is from 'autoarray.h'.
+/// Classes Matrix (Z2matrix) and simplelist are from 'chain.h'.the class auto_array is from 'autoarray.h'.
 /// Some functions (especially concerned with whitney class) in class Z2matirix are original ones.
 ///
 /////////////////////////////////////////////////////////////////////////////
@@ -41,10 +41,14 @@
 #include <iomanip>
 #include <algorithm>
 #include <sstream>
+#include <cstdint>
 #include "poset_convert.h"
-class simplelist;
-class auto_array;
-class Z2matrix;
+#include "simplex_tree.h"
+#include "Z2integer.h"
+#include "chain.h"
+template <class euclidom> class simplelist;
+template <class T> class auto_array;
+template <class euclidom> class Matrix;
 
 // --------------------------------------------------
 // ------------------- simplelist -------------------
@@ -52,6 +56,7 @@ class Z2matrix;
 
 /// This class defines a simple list of pointers to objects
 /// of the given type. It is a helper class used in chain complex.
+template <class euclidom>
 class simplelist
 {
 public:
@@ -62,17 +67,17 @@ public:
 	~simplelist ();
 
 	/// Adds an element to the list.
-	void add (Z2matrix &m);
+	void add (Matrix<euclidom> &m);
 
 	/// Remove an element from the list.
-	void remove (Z2matrix &m);
+	void remove (Matrix<euclidom> &m);
 
 	/// A simple internal iterator of the list. A call to this function
 	/// returns an element from the list, but does not remove it from the
 	/// list, and sets the internal iterator for the next element.
 	/// After the last element has been taken, returns 0 and rewinds
 	/// the iterator to the beginning of the list.
-	Z2matrix *take ();
+	Matrix<euclidom> *take ();
 
 private:
 	/// The copy constructor is not implemented.
@@ -98,28 +103,31 @@ private:
 	int cur;
 
 	/// A table of element pointers.
-	Z2matrix **elem;
+	Matrix<euclidom> **elem;
 
 }; /* class simplelist */
 
 // --------------------------------------------------
 
 
-inline simplelist::simplelist (): num (0), cur (0), elem (NULL)
+template <class euclidom>
+inline simplelist<euclidom>::simplelist (): num (0), cur (0), elem (NULL)
 {
 	return;
 } /* simplelist::simplelist */
 
-inline simplelist::~simplelist ()
+template <class euclidom>
+inline simplelist<euclidom>::~simplelist ()
 {
 	if (elem)
 		delete [] elem;
 	return;
 } /* simplelist::~simplelist */
 
-inline void simplelist::add (Z2matrix &m)
+template <class euclidom>
+inline void simplelist<euclidom>::add (Matrix<euclidom> &m)
 {
-	Z2matrix **newelem = new Z2matrix * [num + 1];
+	Matrix<euclidom> **newelem = new Matrix<euclidom> * [num + 1];
 	for (int i = 0; i < num; ++ i)
 		newelem [i] = elem [i];
 	newelem [num ++] = &m;
@@ -128,7 +136,8 @@ inline void simplelist::add (Z2matrix &m)
 	return;
 } /* simplelist::add */
 
-inline void simplelist::remove (Z2matrix &m)
+template <class euclidom>
+inline void simplelist<euclidom>::remove (Matrix<euclidom> &m)
 {
 	int pos = 0;
 	while ((pos < num) && (elem [pos] != &m))
@@ -142,7 +151,8 @@ inline void simplelist::remove (Z2matrix &m)
 	return;
 } /* simplelist::remove */
 
-inline Z2matrix *simplelist::take ()
+template <class euclidom>
+inline Matrix<euclidom> *simplelist<euclidom>::take ()
 {
 	if (cur >= num)
 	{
@@ -156,17 +166,18 @@ inline Z2matrix *simplelist::take ()
 } /* simplelist::take */
 
 
+template <class T>
 class auto_array
 {
 private:
-	chain *ptr;
+	T *ptr;
 
 public:
-	/* /// The type of the elements in the array. */
-	/* typedef T chain; */
+	/// The type of the elements in the array.
+	typedef T element_type;
 
 	/// The constructor.
-	explicit auto_array (chain *p = 0) throw (): ptr (p) {}
+	explicit auto_array (T *p = 0) throw (): ptr (p) {}
 
 	/// Copy constructor.
 	auto_array (auto_array &a) throw (): ptr (a. release ()) {}
@@ -187,21 +198,21 @@ public:
 	}
 
 	/// Returns the internally stored pointer to an array.
-	chain *get () const throw ()
+	T *get () const throw ()
 	{
 		return ptr;
 	}
 
 	/// Releases the pointer and returns it.
-	chain *release () throw ()
+	T *release () throw ()
 	{
-		chain *tmp = ptr;
+		T *tmp = ptr;
 		ptr = 0;
 		return tmp;
 	}
 
 	/// Resets the object to hold another pointer.
-	void reset (chain *p = 0) throw ()
+	void reset (T *p = 0) throw ()
 	{
 		if (p != ptr)
 		{
@@ -216,26 +227,31 @@ public:
 
 
 // --------------------------------------------------
-// -------------------- Z2matrix ---------------------
+// --------------------- Matrix ---------------------
 // --------------------------------------------------
 
 /// A class for representing sparse matrices containing elements
-/// of the 'euclidom' type. This class has very specific functionality
+/// of the 'euclidom' type (GF2 or Zp). This class has very specific functionality
 /// to be used mainly for the purpose of homology computation.
 
 
-class Z2matrix
+template <class euclidom>
+class Matrix
 {
 public:
 	/// The default constructor.
-	Z2matrix ();
+	Matrix ();
 	/// The copy constructor
-	Z2matrix (const Z2matrix &m);
+	Matrix (const Matrix &m);
 	/// The assignment operator.
-	Z2matrix &operator = (const Z2matrix &s);
+	Matrix &operator = (const Matrix &s);
+	/// The move constructor. Takes the rows and columns of the other matrix.
+	Matrix (Matrix &&m);
+	/// The move assignment operator.
+	Matrix &operator = (Matrix &&m);
 
 	/// The destructor of a matrix.
-	~Z2matrix ();
+	~Matrix ();
 
 	/// Defines the number of rows and columns
         /// and increases the internal tables if necessary.
@@ -246,18 +262,18 @@ public:
 	void identity (int size);
 
 	/// Adds a value to (row,col) element of the matrix.
-	void add (int row, int col, const Z2integer &e);
+	void add (int row, int col, const euclidom &e);
 
 	/// Returns the value at the desired elem of the matrix.
 	/// If 'row' or 'col' is -1, gets the first element
 	/// in it or returns 0 if the colum/row is empty.
-	Z2integer get (int row, int col) const;
+	euclidom get (int row, int col) const;
 
 	/// Returns a reference to the entire row stored as a chain.
-	const chain &getrow (int n) const;
+	const chain<euclidom> &getrow (int n) const;
 
 	/// Returns a reference to the entire column stored as a chain.
-	const chain &getcol (int n) const;
+	const chain<euclidom> &getcol (int n) const;
 
 	/// Returns the number of rows in the matrix.
 	int getnrows () const;
@@ -267,11 +283,11 @@ public:
 
 	/// Adds one row to another with a given coefficient.
 	/// Updates all the matrices which are linked to this one.
-	void addrow (int dest, int source, const Z2integer &e);
+	void addrow (int dest, int source, const euclidom &e);
 
 	/// Adds one column to another with a given coefficient.
 	/// Updates all the matrices which are linked to this one.
-	void addcol (int dest, int source, const Z2integer &e);
+	void addcol (int dest, int source, const euclidom &e);
 
 	/// Swaps two rows of the matrix.
 	/// Updates all the matrices which are linked to this one.
@@ -282,10 +298,10 @@ public:
 	void swapcols (int i, int j);
 
 	 /// Multiplies the row by the given coefficient and updates columns.
-	void multiplyrow (int n, const Z2integer &e);
+	void multiplyrow (int n, const euclidom &e);
 
 	/// Multiplies the column by the given coefficient and updates rows.
-	void multiplycol (int n, const Z2integer &e);
+	void multiplycol (int n, const euclidom &e);
 
 	/// Finds a row containing at least the required number of nonzero
 	/// elements, starting at the given row.
@@ -302,7 +318,7 @@ public:
 	int findcol (int req_elements = 1, int start = -1) const;
 
         //Finds the row index of lowest one in column j;
-        int low(int j);
+        int low(int j) const;
 
 	/// Reduces the given row of the matrix and updates its columns.
 	/// A preferred number of a column to leave is given.
@@ -324,54 +340,27 @@ public:
 
 	/// Computes the product of the two given matrices.
 	/// The matrix is replaced with the product.
-	void multiply (const Z2matrix &m1,const Z2matrix &m2);
+	void multiply (const Matrix &m1,const Matrix &m2);
 
 
-        void showAsMatrix(Z2matrix m);
-        Z2matrix action (Z2matrix m,chain c);
         // make the form R = d*V
         // R and d code the infomation of homology and its generator.
-        void reduceBoundary (Z2matrix &boundray,Z2matrix &v);
+        void reduceBoundary (Matrix &boundray,Matrix &v);
 
-        int minInd(Z2matrix boundary,int j);
-
-        /*
-          input : simpleces list
-          return: boundarymatrix
-        */
-        Z2matrix makeBoundaryMatrix(std::vector<std::vector<int>> simpleces);
-        /*
-          input : filename
-          return: boudarymatrix
-         */
-        //        Z2matrix makeBoundaryMatrixFromPosetFile(std::string filename);
-        int lowestNum(std::vector<std::vector<int>> simpleces,Z2matrix reducedBoundary,int p);
-        std::vector<int> lowestIndexList(std::vector<std::vector<int>> simpleces,Z2matrix reducedBoundary,int p);
-        int zero(std::vector<std::vector<int>> simpleces,Z2matrix reducedBoundary,int p);
-        void showHomology(Z2matrix reducedBoundary, std::vector<std::vector<int>> simpleces);
-
-        void showHomologyGenerator(Z2matrix reducedBoundary, Z2matrix basisChange, std::vector<std::vector<int>> simpleces,std::vector<int> &generatorIndexList);
-
-        int findlowCol(Z2matrix matrix,int n);
-
-        void detectWhitneyClass(chain &whitneyChain, Z2matrix image,const std::vector<int> generatorIndexList);
-
-        void showWhitneyClass(chain whitneychain, /* Z2matrix basechange, */std::vector<std::vector<int>> simpleces,std::vector<int> generatorIndexList);
-        /* void showWhitneyAsHomGen(std::vector<chain> chainList,std::vector<int> generatorIndexList); */
 	/// This is a list of matrices to be updated together with the
 	/// changes to the columns or rows of the current matrix.
 	/// These matrices may have these spaces as their domains or
 	/// ranges (codomains, images).
 	/// For instance, "dom_img" is a list of matrices such that the
 	/// domain of the current matrix is the image of each of them.
-	simplelist dom_dom, dom_img, img_dom,img_img;
+	simplelist<euclidom> dom_dom, dom_img, img_dom,img_img;
 
 
         /* --- show member functions ---*/
 
 	/// Writes the matrix to an output stream by its rows or columns.
 	outputstream &showrowscols (outputstream &out,
-		chain *table, int tablen,
+		chain<euclidom> *table, int tablen,
 		int first = 0, int howmany = 0,
 		const char *label = NULL) const;
 
@@ -406,10 +395,10 @@ private:
 	int allcols;
 
 	/// The rows of the matrix.
-	chain *rows;
+	chain<euclidom> *rows;
 
 	/// The columns of the matrix.
-	chain *cols;
+	chain<euclidom> *cols;
 
 	/// An internal procedure for both findrow and findcol.
 	/// The value of which is: row = 1, col = 0.
@@ -426,28 +415,34 @@ private:
 	/// columns.
 	void increasecols (int numcols);
 
-}; /* class Z2matrix */
+}; /* class Matrix */
+
+/// The matrices over Z_2 used for the homology and the whitney classes.
+typedef Matrix<Z2integer> Z2matrix;
 
 // --------------------------------------------------
 
-inline Z2matrix::Z2matrix (): nrows (0), ncols (0),
+template <class euclidom>
+inline Matrix<euclidom>::Matrix (): nrows (0), ncols (0),
 	allrows (0), allcols (0), rows (NULL), cols (NULL)
 {
 	return;
-} /* Z2matrix::Z2matrix */
+} /* Matrix::Matrix */
 
 
-inline Z2matrix::~Z2matrix ()
+template <class euclidom>
+inline Matrix<euclidom>::~Matrix ()
 {
 	if (rows)
 		delete [] rows;
 	if (cols)
 		delete [] cols;
 	return;
-} /* Z2matrix::~Z2matrix */
+} /* Matrix::~Matrix */
 
 
-inline void Z2matrix::define (int numrows, int numcols)
+template <class euclidom>
+inline void Matrix<euclidom>::define (int numrows, int numcols)
 {
 	// verify that no nonzero entry will be thrown away
 	if ((nrows > numrows) || (ncols > numcols))
@@ -461,9 +456,10 @@ inline void Z2matrix::define (int numrows, int numcols)
 	ncols = numcols;
 
 	return;
-} /* Z2matrix::define */
+} /* Matrix::define */
 
-inline Z2matrix::Z2matrix (const Z2matrix &m)
+template <class euclidom>
+inline Matrix<euclidom>::Matrix (const Matrix &m)
 {
 	nrows = m.nrows;
 	ncols = m.ncols;
@@ -474,7 +470,7 @@ inline Z2matrix::Z2matrix (const Z2matrix &m)
 	cols = NULL;
 	if (m. allrows > 0)
 	{
-		chain *newrows = new chain [m. allrows];
+		chain<euclidom> *newrows = new chain<euclidom> [m. allrows];
 		if (!newrows)
 			throw "Not enough memory for matrix rows.";
 		for (int i = 0; i < m. allrows; ++ i)
@@ -484,17 +480,18 @@ inline Z2matrix::Z2matrix (const Z2matrix &m)
 
 	if (m. allcols > 0)
 	{
-		chain *newcols = new chain [m. allcols];
+		chain<euclidom> *newcols = new chain<euclidom> [m. allcols];
 		if (!newcols)
 			throw "Not enough memory for matrix columns.";
 		for (int i = 0; i < m.allcols; ++ i)
 			newcols [i] = m. cols [i];
 		cols = newcols;
 	}
-} /* Z2matrix::Z2matrix */
+} /* Matrix::Matrix */
 
-inline Z2matrix &Z2matrix::operator =
-	(const Z2matrix &m)
+template <class euclidom>
+inline Matrix<euclidom> &Matrix<euclidom>::operator =
+	(const Matrix &m)
 {
 	// first release allocated tables if any
 	if (rows)
@@ -511,7 +508,7 @@ inline Z2matrix &Z2matrix::operator =
 	cols = NULL;
 	if (m. allrows > 0)
 	{
-		chain *newrows = new chain [m. allrows];
+		chain<euclidom> *newrows = new chain<euclidom> [m. allrows];
 		if (!newrows)
 			throw "Not enough memory for matrix rows.";
 		for (int i = 0; i < m. allrows; ++ i)
@@ -521,7 +518,7 @@ inline Z2matrix &Z2matrix::operator =
 
 	if (m. allcols > 0)
 	{
-		chain *newcols = new chain [m. allcols];
+		chain<euclidom> *newcols = new chain<euclidom> [m. allcols];
 		if (!newcols)
 			throw "Not enough memory for matrix columns.";
 		for (int i = 0; i < m.allcols; ++ i)
@@ -530,9 +527,42 @@ inline Z2matrix &Z2matrix::operator =
 	}
 
 	return *this;
-} /* Z2matrix::operator = */
+} /* Matrix::operator = */
+
+template <class euclidom>
+inline Matrix<euclidom>::Matrix (Matrix &&m): nrows (m. nrows),
+	ncols (m. ncols), allrows (m. allrows), allcols (m. allcols),
+	rows (m. rows), cols (m. cols)
+{
+	m. nrows = m. ncols = m. allrows = m. allcols = 0;
+	m. rows = NULL;
+	m. cols = NULL;
+	return;
+} /* Matrix::Matrix */
+
+template <class euclidom>
+inline Matrix<euclidom> &Matrix<euclidom>::operator = (Matrix &&m)
+{
+	if (&m == this)
+		return *this;
+	if (rows)
+		delete [] rows;
+	if (cols)
+		delete [] cols;
+	nrows = m. nrows;
+	ncols = m. ncols;
+	allrows = m. allrows;
+	allcols = m. allcols;
+	rows = m. rows;
+	cols = m. cols;
+	m. nrows = m. ncols = m. allrows = m. allcols = 0;
+	m. rows = NULL;
+	m. cols = NULL;
+	return *this;
+} /* Matrix::operator = */
 
-inline void Z2matrix::identity (int size)
+template <class euclidom>
+inline void Matrix<euclidom>::identity (int size)
 {
 	if (!nrows && !ncols)
 		increase (size, size);
@@ -540,15 +570,16 @@ inline void Z2matrix::identity (int size)
 		size = (nrows < ncols) ? nrows : ncols;
 	for (int i = 0; i < size; ++ i)
 	{
-		Z2integer one;
+		euclidom one;
 		one = 1;
 		add (i, i, one);
 	}
 	return;
-} /* Z2matrix::identity */
+} /* Matrix::identity */
 
 
-inline void Z2matrix::add (int row, int col, const Z2integer &e)
+template <class euclidom>
+inline void Matrix<euclidom>::add (int row, int col, const euclidom &e)
 // A [r] [c] += e;
 {
 	if (row < 0)
@@ -572,15 +603,16 @@ inline void Z2matrix::add (int row, int col, const Z2integer &e)
 	cols [col]. add (row, e);
 	rows [row]. add (col, e);
 	return;
-} /* Z2matrix::add */
+} /* Matrix::add */
 
 
-inline Z2integer Z2matrix::get (int row, int col) const
+template <class euclidom>
+inline euclidom Matrix<euclidom>::get (int row, int col) const
 // return (A [r] [c]);
 {
 	if ((row >= nrows) || (col >= ncols))
 	{
-		Z2integer zero;
+		euclidom zero;
 		zero = 0;
 		return zero;
 	}
@@ -590,40 +622,45 @@ inline Z2integer Z2matrix::get (int row, int col) const
 		return cols [col]. getcoefficient (row);
 	else
 	{
-		Z2integer zero;
+		euclidom zero;
 		zero = 0;
 		return zero;
 	}
-} /* Z2matrix::get */
+} /* Matrix::get */
 
-inline const chain &Z2matrix::getrow (int n) const
+template <class euclidom>
+inline const chain<euclidom> &Matrix<euclidom>::getrow (int n) const
 {
 	if ((n < 0) || (n >= nrows))
 		throw "Incorrect row number.";
 	return rows [n];
-} /* Z2matrix::getrow */
+} /* Matrix::getrow */
 
-inline const chain &Z2matrix::getcol (int n) const
+template <class euclidom>
+inline const chain<euclidom> &Matrix<euclidom>::getcol (int n) const
 {
 	if ((n < 0) || (n >= ncols))
 		throw "Incorrect column number.";
 	return cols [n];
-} /* Z2matrix::getcol */
+} /* Matrix::getcol */
 
-inline int Z2matrix::getnrows () const
+template <class euclidom>
+inline int Matrix<euclidom>::getnrows () const
 {
 	return nrows;
-} /* Z2matrix::getnrows */
+} /* Matrix::getnrows */
 
 
-inline int Z2matrix::getncols () const
+template <class euclidom>
+inline int Matrix<euclidom>::getncols () const
 {
 	return ncols;
-} /* Z2matrix::getncols */
+} /* Matrix::getncols */
 
 
-inline void Z2matrix::addrow (int dest, int source,
-	const Z2integer &e)
+template <class euclidom>
+inline void Matrix<euclidom>::addrow (int dest, int source,
+	const euclidom &e)
 {
 	// check if the parameters are not out of range
 	if ((dest < 0) || (dest >= nrows) || (source < 0) ||
@@ -634,7 +671,7 @@ inline void Z2matrix::addrow (int dest, int source,
 	rows [dest]. add (rows [source], e, dest, cols);
 
 	// update the other matrices
-	Z2matrix *m;
+	Matrix *m;
 	while ((m = img_img. take ()) != NULL)
 		if (m -> rows)
 			m -> rows [dest]. add (m -> rows [source], e,
@@ -646,11 +683,12 @@ inline void Z2matrix::addrow (int dest, int source,
 				source, m -> rows);
 
 	return;
-} /* Z2matrix::addrow */
+} /* Matrix::addrow */
 
 
-inline void Z2matrix::addcol (int dest, int source,
-	const Z2integer &e)
+template <class euclidom>
+inline void Matrix<euclidom>::addcol (int dest, int source,
+	const euclidom &e)
 {
 	// check if the parameters are not out of range
 	if ((dest < 0) || (dest >= ncols) || (source < 0) ||
@@ -661,7 +699,7 @@ inline void Z2matrix::addcol (int dest, int source,
 	cols [dest]. add (cols [source], e, dest, rows);
 
 	// update the other matrices
-	Z2matrix *m;
+	Matrix *m;
 	while ((m = dom_dom. take ()) != NULL)
 		if (m -> cols)
 			m -> cols [dest]. add (m -> cols [source], e,
@@ -673,10 +711,11 @@ inline void Z2matrix::addcol (int dest, int source,
 				source, m -> cols);
 
 	return;
-} /* Z2matrix::addcol */
+} /* Matrix::addcol */
 
 
-inline void Z2matrix::swaprows (int i, int j)
+template <class euclidom>
+inline void Matrix<euclidom>::swaprows (int i, int j)
 {
 	// in the trivial case nothing needs to be done
 	if (i == j)
@@ -690,7 +729,7 @@ inline void Z2matrix::swaprows (int i, int j)
 	rows [i]. swap (rows [j], i, j, cols);
 
 	// update the other matrices
-	Z2matrix *m;
+	Matrix *m;
 	while ((m = img_img. take ()) != NULL)
 		if ((m -> rows) && (m -> nrows))
 			m -> rows [i]. swap (m -> rows [j], i, j, m -> cols);
@@ -700,10 +739,11 @@ inline void Z2matrix::swaprows (int i, int j)
 			m -> cols [i]. swap (m -> cols [j], i, j, m -> rows);
 
 	return;
-} /* Z2matrix::swaprows */
+} /* Matrix::swaprows */
 
 
-inline void Z2matrix::swapcols (int i, int j)
+template <class euclidom>
+inline void Matrix<euclidom>::swapcols (int i, int j)
 {
 	// in the trivial case nothing needs to be done
 	if (i == j)
@@ -717,7 +757,7 @@ inline void Z2matrix::swapcols (int i, int j)
 	cols [i]. swap (cols [j], i, j, rows);
 
 	// update the other matrices
-	Z2matrix *m;
+	Matrix *m;
 	while ((m = dom_dom. take ()) != NULL)
 		if ((m -> cols) && (m -> ncols))
 			m -> cols [i]. swap (m -> cols [j], i, j, m -> rows);
@@ -727,13 +767,14 @@ inline void Z2matrix::swapcols (int i, int j)
 			m -> rows [i]. swap (m -> rows [j], i, j, m -> cols);
 
 	return;
-} /* Z2matrix::swapcols */
+} /* Matrix::swapcols */
 
 
-inline void Z2matrix::multiplyrow (int n, const Z2integer &e)
+template <class euclidom>
+inline void Matrix<euclidom>::multiplyrow (int n, const euclidom &e)
 {
 	// retrieve the row
-	chain &therow = rows [n];
+	chain<euclidom> &therow = rows [n];
 
 	// multiply the row
 	therow. multiply (e);
@@ -743,13 +784,14 @@ inline void Z2matrix::multiplyrow (int n, const Z2integer &e)
 		cols [therow. num (i)]. multiply (e, n);
 
 	return;
-} /* Z2matrix::multiplyrow */
+} /* Matrix::multiplyrow */
 
 
-inline void Z2matrix::multiplycol (int n, const Z2integer &e)
+template <class euclidom>
+inline void Matrix<euclidom>::multiplycol (int n, const euclidom &e)
 {
 	// retrieve the row
-	chain &thecol = cols [n];
+	chain<euclidom> &thecol = cols [n];
 
 	// multiply the row
 	thecol. multiply (e);
@@ -759,11 +801,12 @@ inline void Z2matrix::multiplycol (int n, const Z2integer &e)
 		rows [thecol. num (i)]. multiply (e, n);
 
 	return;
-} /* Z2matrix::multiplycol */
+} /* Matrix::multiplycol */
 
 
 
-inline int Z2matrix::findrowcol (int req_elements, int start,
+template <class euclidom>
+inline int Matrix<euclidom>::findrowcol (int req_elements, int start,
 	int which) const
 {
 	// start at the starting point
@@ -828,31 +871,33 @@ inline int Z2matrix::findrowcol (int req_elements, int start,
 
 	// if not found, return the recent candidate (or -1 if none)
 	return candidate;
-} /* Z2matrix::findrowcol */
+} /* Matrix::findrowcol */
 
 
-inline int Z2matrix::findrow (int req_elements, int start) const
+template <class euclidom>
+inline int Matrix<euclidom>::findrow (int req_elements, int start) const
 {
 	return findrowcol (req_elements, start, 1);
-} /* Z2matrix::findrow */
+} /* Matrix::findrow */
 
-inline int Z2matrix::low(int j)
+template <class euclidom>
+inline int Matrix<euclidom>::low(int j) const
 {
-  const chain colj = getcol(j);
+  const chain<euclidom> &colj = getcol(j);
   if (colj.empty()) return -1;
-  for (int i = getncols()-1;; --i)
-    {
-      if (colj.getcoefficient(i) == (Z2integer) 1) return i+1;
-    }
-}/* Z2matrix::low */
+  /* the identifiers in a chain are kept in the ascending order */
+  return colj.num(colj.size()-1)+1;
+}/* Matrix::low */
 
-inline int Z2matrix::findcol (int req_elements, int start) const
+template <class euclidom>
+inline int Matrix<euclidom>::findcol (int req_elements, int start) const
 {
 	return findrowcol (req_elements, start, 0);
-} /* Z2matrix::findcol */
+} /* Matrix::findcol */
 
 
-inline int Z2matrix::reducerow (int n, int preferred)
+template <class euclidom>
+inline int Matrix<euclidom>::reducerow (int n, int preferred)
 {
 	if (n >= nrows)
 		throw "Trying to reduce a row out of range.";
@@ -864,7 +909,7 @@ inline int Z2matrix::reducerow (int n, int preferred)
 	while ((len = rows [n]. size ()) > 1)
 	{
 		// copy the row to a local structure
-		chain local (rows [n]);
+		chain<euclidom> local (rows [n]);
 
 		// find the best element in this row
 		int best_i = local. findbest (cols);
@@ -891,7 +936,7 @@ inline int Z2matrix::reducerow (int n, int preferred)
 				continue;
 
 			// compute the quotient of two elements
-			Z2integer quotient = local. coef (i) /
+			euclidom quotient = local. coef (i) /
 				local. coef (best_i);
 
 			// subtract the chosen column from the other one
@@ -901,10 +946,11 @@ inline int Z2matrix::reducerow (int n, int preferred)
 	}
 
 	return the_other;
-} /* Z2matrix::reducerow */
+} /* Matrix::reducerow */
 
 
-inline int Z2matrix::reducecol (int n, int preferred)
+template <class euclidom>
+inline int Matrix<euclidom>::reducecol (int n, int preferred)
 {
 	if (n >= ncols)
 		throw "Trying to reduce a column out of range.";
@@ -916,7 +962,7 @@ inline int Z2matrix::reducecol (int n, int preferred)
 	while ((len = cols [n]. size ()) > 1)
 	{
 		// copy the column to a local structure
-		chain local (cols [n]);
+		chain<euclidom> local (cols [n]);
 
 		// find the best element in this column
 		int best_i = local. findbest (rows);
@@ -943,7 +989,7 @@ inline int Z2matrix::reducecol (int n, int preferred)
 				continue;
 
 			// compute the quotient of two elements
-			Z2integer quotient = local. coef (i) /
+			euclidom quotient = local. coef (i) /
 				local. coef (best_i);
 
 			// subtract the chosen row from the other one
@@ -953,11 +999,12 @@ inline int Z2matrix::reducecol (int n, int preferred)
 	}
 
 	return the_other;
-} /* Z2matrix::reducecol */
+} /* Matrix::reducecol */
 
 
-inline outputstream &Z2matrix::showrowscols (outputstream &out,
-	chain *table, int tablen, int first, int howmany,
+template <class euclidom>
+inline outputstream &Matrix<euclidom>::showrowscols (outputstream &out,
+	chain<euclidom> *table, int tablen, int first, int howmany,
 	const char *label) const
 {
 	if ((first < 0) || (first >= tablen))
@@ -971,36 +1018,41 @@ inline outputstream &Z2matrix::showrowscols (outputstream &out,
 	return out;
 } /* matrix::showrowscols */
 
-inline outputstream &Z2matrix::showrows (outputstream &out,
+template <class euclidom>
+inline outputstream &Matrix<euclidom>::showrows (outputstream &out,
 	int first, int howmany, const char *label) const
 {
 	return showrowscols (out, rows, nrows, first, howmany, label);
-} /* Z2matrix::showrows */
+} /* Matrix::showrows */
 
-inline std::ostream &Z2matrix::showrows (std::ostream &out,
+template <class euclidom>
+inline std::ostream &Matrix<euclidom>::showrows (std::ostream &out,
 	int first, int howmany, const char *label) const
 {
 	outputstream tout (out);
 	showrows (tout, first, howmany, label);
 	return out;
-} /* Z2matrix::showrows */
+} /* Matrix::showrows */
 
-inline outputstream &Z2matrix::showcols (outputstream &out,
+template <class euclidom>
+inline outputstream &Matrix<euclidom>::showcols (outputstream &out,
 	int first, int howmany, const char *label) const
 {
 	return showrowscols (out, cols, ncols, first, howmany, label);
-} /* Z2matrix::showcols */
+} /* Matrix::showcols */
 
-inline std::ostream &Z2matrix::showcols (std::ostream &out,
+template <class euclidom>
+inline std::ostream &Matrix<euclidom>::showcols (std::ostream &out,
 	int first, int howmany, const char *label) const
 {
 	outputstream tout (out);
 	showcols (tout, first, howmany, label);
 	return out;
-} /* Z2matrix::showcols */
+} /* Matrix::showcols */
 
 
-inline void Z2matrix::invert (void)
+template <class euclidom>
+inline void Matrix<euclidom>::invert (void)
 {
 	// check if the matrix is square
 	if (nrows != ncols)
@@ -1011,7 +1063,7 @@ inline void Z2matrix::invert (void)
 		return;
 
 	// create the identity matrix of the appropriate size
-	Z2matrix m;
+	Matrix m;
 	m. identity (ncols);
 	// transform the matrix to the identity
 	// by row operations (swapping and adding)
@@ -1038,9 +1090,8 @@ inline void Z2matrix::invert (void)
 		}
 
 		// make the leading entry equal 1 in the chosen row
-		Z2integer invcoef;
+		euclidom invcoef;
 		invcoef = 1;
-		invcoef = invcoef;
 		m. multiplyrow (cols [col]. num (chosen), invcoef);
 		multiplyrow (cols [col]. num (chosen), invcoef);
 
@@ -1054,7 +1105,7 @@ inline void Z2matrix::invert (void)
 		{
 			if (cols [col]. num (i) == col)
 				continue;
-			Z2integer coef = invcoef * cols [col]. coef (i);
+			euclidom coef = invcoef * cols [col]. coef (i);
 			m. addrow (cols [col]. num (i), col, coef);
 			addrow (cols [col]. num (i), col, coef);
 			-- i;
@@ -1070,11 +1121,12 @@ inline void Z2matrix::invert (void)
 	}
 
 	return;
-} /* Z2matrix::invert */
+} /* Matrix::invert */
 
 
-inline void Z2matrix::multiply (const Z2matrix &m1,
-	const Z2matrix &m2)
+template <class euclidom>
+inline void Matrix<euclidom>::multiply (const Matrix &m1,
+	const Matrix &m2)
 {
 	if (m1. ncols != m2. nrows)
 		throw "Trying to multiply matrices of wrong sizes.";
@@ -1084,7 +1136,7 @@ inline void Z2matrix::multiply (const Z2matrix &m1,
 	{
 		for (int j = 0; j < ncols; ++ j)
 		{
-			Z2integer e;
+			euclidom e;
 			e = 0;
 			for (int k = 0; k < K; ++ k)
 				e += m1. get (i, k) * m2. get (k, j);
@@ -1092,14 +1144,14 @@ inline void Z2matrix::multiply (const Z2matrix &m1,
 		}
 	}
 	return;
-} /* Z2matrix::multiply */
+} /* Matrix::multiply */
 
-void showAsMatrix(Z2matrix matrix)
+void showAsMatrix(const Z2matrix& matrix)
 {
   std::cout << "showAsMatrix" << matrix.getnrows() <<" times " << matrix.getncols() << std::endl;
   for (int i = 0; i < matrix.getnrows(); ++i)
     {
-      chain k = matrix.getrow(i);
+      const Z2chain &k = matrix.getrow(i);
       for (int j = 0; j < matrix.getncols(); ++j)
         {
           if (k.findnumber(j) != -1)
@@ -1116,7 +1168,7 @@ void showAsMatrix(Z2matrix matrix)
 }
 
 
-Z2matrix action(Z2matrix m,chain c)
+Z2matrix action(const Z2matrix& m,const Z2chain& c)
 {
   Z2matrix cha = Z2matrix();
   cha.define(m.getncols(),1);
@@ -1130,7 +1182,8 @@ Z2matrix action(Z2matrix m,chain c)
 
 }
 
-inline void Z2matrix::reduceBoundary (Z2matrix &boundary,Z2matrix &v)
+template <class euclidom>
+inline void Matrix<euclidom>::reduceBoundary (Matrix<euclidom> &boundary,Matrix<euclidom> &v)
 {
   int size = boundary.getnrows();
   for (int i = 0; i < size; ++i)
@@ -1139,8 +1192,11 @@ inline void Z2matrix::reduceBoundary (Z2matrix &boundary,Z2matrix &v)
         {
           if ((boundary.low(j) == boundary.low(i)) && (boundary.low(i) != -1) )
             {
-              v.addcol(i,j,(Z2integer) 1);
-              boundary.addcol(i,j,(Z2integer) 1);
+              /* the lowest entry of the column i is cancelled */
+              int row = boundary.low(i) - 1;
+              euclidom e = -(boundary.get(row,i) / boundary.get(row,j));
+              v.addcol(i,j,e);
+              boundary.addcol(i,j,e);
               j = 0;
             }
         }
@@ -1148,27 +1204,56 @@ inline void Z2matrix::reduceBoundary (Z2matrix &boundary,Z2matrix &v)
 }
 
 // make boudary operator from simpleces list(std::vector<std::vector<int>> simpleces)
-inline Z2matrix makeBoundaryMatrix(std::vector<std::vector<int>> simpleces){
+// each face of a column is found in the simplex tree by deleting one vertex.
+// a simplex is oriented by the ascending order of its vertrices, so the face
+// without the k-th smallest vertex has the sign (-1)^k (always 1 over Z_2).
+template <class euclidom = Z2integer>
+inline Matrix<euclidom> makeBoundaryMatrix(const std::vector<std::vector<int>>& simpleces){
   int size = simpleces.size() + 1;
-  /* debug */
-  /* for (auto x:simpleces) */
-  /*   { */
-  /*     for(auto y:x){ */
-  /*       std::cout << y << "," << std::flush; */
-  /*     } */
-  /*     std::cout << std::endl; */
-  /*   } */
-  Z2matrix boundary = Z2matrix();
+  Matrix<euclidom> boundary = Matrix<euclidom>();
   boundary.define(size,size);
-  for (int i = 0; i < size-1; ++i)
+  for (int j = 0; j < size-1; ++j)
+    {
+      if(simpleces[j].size() == 1){
+        boundary.add(0,j+1,(euclidom) 1);
+      }
+    }
+  /* few vertrices: the faces are found by clearing one bit of the mask */
+  vertexBits bits(simpleces);
+  int width = maskWidth(bits.size());
+  auto addFace = [&boundary](int i,int j,int k){
+    boundary.add(i+1,j+1,(euclidom) ((k & 1) ? -1 : 1));
+  };
+  if (width == 64)
     {
-      for (int j = 0; j < size-1; ++j)
+      forEachFaceByMask<mask64>(simpleces,bits,addFace);
+      return boundary;
+    }
+#ifdef MASK128
+  if (width == 128)
+    {
+      forEachFaceByMask<mask128>(simpleces,bits,addFace);
+      return boundary;
+    }
+#endif
+  /* low dimension: kernels specialized to the top dimension */
+  if (forEachFaceByFixedSimplex(simpleces,dimention(simpleces),addFace))
+    {
+      return boundary;
+    }
+  simplexTree index(simpleces);
+  for (int j = 0; j < size-1; ++j)
+    {
+      if(simpleces[j].size() == 1){
+        continue;
+      }
+      std::vector<int> sorted = simpleces[j];
+      std::sort(sorted.begin(), sorted.end());
+      for (int k = 0; k < sorted.size(); ++k)
         {
-          if(simpleces[j].size() == 1 && i == 0){
-            boundary.add(0,j+1,(Z2integer) 1);
-          }
-          if(isFace(simpleces[j],simpleces[i])){
-            boundary.add(i+1,j+1,(Z2integer) 1);
+          int i = index.findFace(sorted,k);
+          if (i != -1){
+            addFace(i,j,k);
           }
         }
     }
@@ -1178,7 +1263,8 @@ inline Z2matrix makeBoundaryMatrix(std::vector<std::vector<int>> simpleces){
 
 
 
-inline int zero(std::vector<std::vector<int>> simpleces,Z2matrix reducedBoundary,int p)
+template <class euclidom>
+inline int zero(const std::vector<std::vector<int>>& simpleces,const Matrix<euclidom>& reducedBoundary,int p)
 {
   /*make index list*/
   std::vector<int> indexlist;
@@ -1202,7 +1288,8 @@ inline int zero(std::vector<std::vector<int>> simpleces,Z2matrix reducedBoundary
 }
 
 
-inline std::vector<int> lowestIndexList(std::vector<std::vector<int>> simpleces,Z2matrix reducedBoundary,int p)
+template <class euclidom>
+inline std::vector<int> lowestIndexList(const std::vector<std::vector<int>>& simpleces,const Matrix<euclidom>& reducedBoundary,int p)
 {
     /* make index list */
   std::vector<int> indexlist;
@@ -1230,7 +1317,8 @@ inline std::vector<int> lowestIndexList(std::vector<std::vector<int>> simpleces,
 
 
 
-int lowestNum(std::vector<std::vector<int>> simpleces,Z2matrix reducedBoundary,int p)
+template <class euclidom>
+int lowestNum(const std::vector<std::vector<int>>& simpleces,const Matrix<euclidom>& reducedBoundary,int p)
 {
     /* make index list */
   std::vector<int> indexlist;
@@ -1256,31 +1344,55 @@ int lowestNum(std::vector<std::vector<int>> simpleces,Z2matrix reducedBoundary,i
   return lowest.size();
 }
 
-void showHomology(Z2matrix reducedBoundary, std::vector<std::vector<int>> simpleces){
-  int topdim = dimention(simpleces);
-  std::cout << std::endl;
+/* the betti numbers of the dimensions below topdim, by default up to that of the simpleces */
+template <class euclidom>
+std::vector<std::uint64_t> bettiNumbers(const Matrix<euclidom>& reducedBoundary, const std::vector<std::vector<int>>& simpleces,int topdim = 0){
+  if (topdim <= 0)
+    {
+      topdim = dimention(simpleces);
+    }
+  std::vector<std::uint64_t> betti;
   for (int p = 0; p < topdim; ++p)
     {
-      int betti = zero(simpleces,reducedBoundary,p) - lowestNum(simpleces,reducedBoundary,p);
-      /* std::cout << "p:" << p << "betti:" << betti<< " = zero" << zero(simpleces,reducedBoundary,p) << " - low" << lowestNum(simpleces,reducedBoundary,p) << std::endl; */
-      if (betti == 0)
+      betti.push_back(zero(simpleces,reducedBoundary,p) - lowestNum(simpleces,reducedBoundary,p));
+      /* std::cout << "p:" << p << "betti:" << betti[p]<< " = zero" << zero(simpleces,reducedBoundary,p) << " - low" << lowestNum(simpleces,reducedBoundary,p) << std::endl; */
+    }
+  return betti;
+}
+
+/* H_p = Z_characteristic^betti[p], shown as by showHomology */
+inline void showBettiNumbers(const std::vector<std::uint64_t>& betti,int characteristic){
+  std::cout << std::endl;
+  for (int p = 0; p < betti.size(); ++p)
+    {
+      if (betti[p] == 0)
         {
           std::cout << "H_" << p << " = 0" << std::endl;
-        } else if(betti == 1){
-      std::cout << "H_" << p << " = Z_2" << std::endl;
+        } else if(betti[p] == 1){
+      std::cout << "H_" << p << " = Z_" << characteristic << std::endl;
       } else {
-        std::cout << "H_" << p << " = Z_2^" << betti <<  std::endl;
+        std::cout << "H_" << p << " = Z_" << characteristic << "^" << betti[p] <<  std::endl;
       }
     }
   std::cout << std::endl;
 }
 
+/* topdim: the number of dimensions shown, by default up to that of the simpleces */
+template <class euclidom>
+void showHomology(const Matrix<euclidom>& reducedBoundary, const std::vector<std::vector<int>>& simpleces,int topdim = 0){
+  showBettiNumbers(bettiNumbers(reducedBoundary,simpleces,topdim),euclidom::characteristic());
+}
+
 
-void showHomologyGenerator(Z2matrix reducedBoundary,Z2matrix basisChange, std::vector<std::vector<int>> simpleces,std::vector<int> &generatorIndexList)
+template <class euclidom>
+void showHomologyGenerator(const Matrix<euclidom>& reducedBoundary,const Matrix<euclidom>& basisChange, const std::vector<std::vector<int>>& simpleces,std::vector<int> &generatorIndexList,const vertexLabels &labels = vertexLabels(),int topdim = 0)
 {
   std::vector<int> indexList;
-  std::vector<chain> chainList;
-  int topdim = dimention(simpleces);
+  std::vector<chain<euclidom>> chainList;
+  if (topdim <= 0)
+    {
+      topdim = dimention(simpleces);
+    }
   std::cout <<  std::endl;
   for (int p = 0; p < topdim; ++p)
     {
@@ -1309,13 +1421,76 @@ void showHomologyGenerator(Z2matrix reducedBoundary,Z2matrix basisChange, std::v
       /* std::cout << std::endl; */
       std::cout << "The generator(s) of H_" << p << " :"<< std::endl;
       // std::cout << std::endl;
-      showChainAsVertex(simpleces,chainList,true,p);
+      showChainAsVertex(simpleces,chainList,true,p,labels);
       chainList = {};
     }
 }
 
 
-inline int findlowCol(Z2matrix matrix,int n){
+/* homology and its generators with coefficients in euclidom */
+template <class euclidom>
+void showHomologyOver(const std::vector<std::vector<int>>& simpleces,const vertexLabels &labels = vertexLabels(),int topdim = 0)
+{
+  Matrix<euclidom> boundary = makeBoundaryMatrix<euclidom>(simpleces);
+  Matrix<euclidom> v = Matrix<euclidom>();
+  v.identity(boundary.getncols());
+  boundary.reduceBoundary(boundary,v);
+  showHomology(boundary,simpleces,topdim);
+  std::vector<int> generatorIndexList = {};
+  showHomologyGenerator(boundary,v,simpleces,generatorIndexList,labels,topdim);
+}
+
+/* the betti numbers with coefficients in euclidom */
+template <class euclidom>
+std::vector<std::uint64_t> bettiNumbersOver(const std::vector<std::vector<int>>& simpleces)
+{
+  Matrix<euclidom> boundary = makeBoundaryMatrix<euclidom>(simpleces);
+  Matrix<euclidom> v = Matrix<euclidom>();
+  v.identity(boundary.getncols());
+  boundary.reduceBoundary(boundary,v);
+  return bettiNumbers(boundary,simpleces);
+}
+
+/* the betti numbers with coefficients in Z_p (p = 2, 3, 5, 7; otherwise none) */
+inline std::vector<std::uint64_t> bettiNumbersModP(int p,const std::vector<std::vector<int>>& simpleces)
+{
+  switch (p)
+    {
+    case 2:
+      return bettiNumbersOver<Z2integer>(simpleces);
+    case 3:
+      return bettiNumbersOver<Zp<3>>(simpleces);
+    case 5:
+      return bettiNumbersOver<Zp<5>>(simpleces);
+    case 7:
+      return bettiNumbersOver<Zp<7>>(simpleces);
+    }
+  return std::vector<std::uint64_t>();
+}
+
+/* homology with coefficients in Z_p; return false if p is not supported */
+inline bool showHomologyModP(int p,const std::vector<std::vector<int>>& simpleces,const vertexLabels &labels = vertexLabels(),int topdim = 0)
+{
+  switch (p)
+    {
+    case 2:
+      showHomologyOver<Z2integer>(simpleces,labels,topdim);
+      return true;
+    case 3:
+      showHomologyOver<Zp<3>>(simpleces,labels,topdim);
+      return true;
+    case 5:
+      showHomologyOver<Zp<5>>(simpleces,labels,topdim);
+      return true;
+    case 7:
+      showHomologyOver<Zp<7>>(simpleces,labels,topdim);
+      return true;
+    }
+  return false;
+}
+
+
+inline int findlowCol(const Z2matrix& matrix,int n){
   for (int i = 0; i < matrix.getncols(); ++i)
     {
       if (matrix.low(i) == n){
@@ -1325,8 +1500,8 @@ inline int findlowCol(Z2matrix matrix,int n){
   return -1;
 
 }
-inline void detectWhitneyClass(chain &whitneychain,Z2matrix image,const std::vector<int> generatorIndexList){
-  chain detection = whitneychain;
+inline void detectWhitneyClass(Z2chain &whitneychain,const Z2matrix& image,const std::vector<int>& generatorIndexList){
+  Z2chain detection = whitneychain;
   while(detection.size() != 0)
     {
       int target = detection.num(detection.size()-1);
@@ -1336,19 +1511,22 @@ inline void detectWhitneyClass(chain &whitneychain,Z2matrix image,const std::vec
         }
       else
         {
-          chain tmp = image.getcol(findlowCol(image,target+1));
+          Z2chain tmp = image.getcol(findlowCol(image,target+1));
           detection.add(tmp);
           whitneychain.add(tmp);
         }
     }
 }
 
-inline void showWhitneyClass(chain whitneychainAfter,/* Z2matrix basechange, */std::vector<std::vector<int>> simpleces,std::vector<int> generatorIndexList)
+inline void showWhitneyClass(const Z2chain& whitneychainAfter,/* Z2matrix basechange, */const std::vector<std::vector<int>>& simpleces,const std::vector<int>& generatorIndexList,int topdim = 0)
 {
   std::vector<int> indexList;
-  std::vector<chain> chainList;
+  std::vector<Z2chain> chainList;
 
-  int topdim = dimention(simpleces);
+  if (topdim <= 0)
+    {
+      topdim = dimention(simpleces);
+    }
 
   for (int p = 0; p < topdim; ++p)
     {
@@ -1412,19 +1590,21 @@ inline void showWhitneyClass(chain whitneychainAfter,/* Z2matrix basechange, */s
 
 
 
-inline void Z2matrix::increase (int numrows, int numcols)
+template <class euclidom>
+inline void Matrix<euclidom>::increase (int numrows, int numcols)
 {
 	increaserows (numrows);
 	increasecols (numcols);
 	return;
-} /* Z2matrix::increase */
+} /* Matrix::increase */
 
 
-inline void Z2matrix::increaserows (int numrows)
+template <class euclidom>
+inline void Matrix<euclidom>::increaserows (int numrows)
 {
 	if (allrows >= numrows)
 		return;
-	chain *newrows = new chain [numrows];
+	chain<euclidom> *newrows = new chain<euclidom> [numrows];
 	if (!newrows)
 		throw "Not enough memory for matrix rows.";
 	for (int i = 0; i < nrows; ++ i)
@@ -1434,14 +1614,15 @@ inline void Z2matrix::increaserows (int numrows)
 	rows = newrows;
 	allrows = numrows;
 	return;
-} /* Z2matrix::increaserows */
+} /* Matrix::increaserows */
 
 
-inline void Z2matrix::increasecols (int numcols)
+template <class euclidom>
+inline void Matrix<euclidom>::increasecols (int numcols)
 {
 	if (allcols >= numcols)
 		return;
-	chain *newcols = new chain [numcols];
+	chain<euclidom> *newcols = new chain<euclidom> [numcols];
 	if (!newcols)
 		throw "Not enough memory for matrix columns.";
 	for (int i = 0; i < ncols; ++ i)
@@ -1452,14 +1633,15 @@ inline void Z2matrix::increasecols (int numcols)
 	allcols = numcols;
 
 	return;
-} /* Z2matrix::increasecols */
+} /* Matrix::increasecols */
 
 // --------------------------------------------------
 
 /// Writes a matrix to the output stream as a map in terms of columns.
 /// Warning: The operators >> and << are not symmetric for matrices.
+template <class euclidom>
 inline std::ostream &operator << (std::ostream &out,
-	const Z2matrix &m)
+	const Matrix<euclidom> &m)
 {
 	return m. showcols (out);
 } /* operator << */
@@ -0,0 +1,271 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file bitmask_simplex.h
+///
+/// This file contains functions to handle a simplex as a bitmask
+/// of its vertrices. They are used when the complex has at most
+/// 64 (or 128) vertrices, and the vector version is used otherwise.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef BITMASK_SIMPLEX_H
+#define BITMASK_SIMPLEX_H
+
+#include <vector>
+#include <algorithm>
+#include <unordered_set>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include "chain_table.h"
+#include "vertex_labels.h"
+
+/// The largest number of vertrices for which simpleces are handled
+/// as bitmasks: 0 (never), 64 or 128. The value 128 is used only if
+/// the compiler has a 128-bit integer type.
+#ifndef SIMPLEXMASK
+#define SIMPLEXMASK 128
+#endif
+
+typedef std::uint64_t mask64;
+
+#if (SIMPLEXMASK >= 128) && defined (__SIZEOF_INT128__)
+#define MASK128 1
+typedef unsigned __int128 mask128;
+#endif
+
+// --------------------------------------------------
+// ------------------ mask algebra ------------------
+// --------------------------------------------------
+
+/* number of vertrices of a simplex */
+inline int maskCount(mask64 m){
+  return __builtin_popcountll(m);
+}
+
+#ifdef MASK128
+inline int maskCount(mask128 m){
+  return __builtin_popcountll((mask64) m) + __builtin_popcountll((mask64) (m >> 64));
+}
+#endif
+
+/* dimension of a simplex */
+template <class word>
+inline int maskDimention(word m){
+  return maskCount(m) - 1;
+}
+
+/* the mask of the vertex with the bit number i */
+template <class word>
+inline word maskBit(int i){
+  return (word) 1 << i;
+}
+
+/* x \in X or not */
+template <class word>
+inline bool maskIsIn(word m,int i){
+  return (m >> i) & 1;
+}
+
+/* return the true when B is subset of A ; B<A */
+template <class word>
+inline bool maskIsSubset(word a,word b){
+  return (a & b) == b;
+}
+
+/* return the true when B is subset of A and dimB=dimA-1  B < A*/
+template <class word>
+inline bool maskIsFace(word a,word b){
+  return maskIsSubset(a,b) && maskCount(a) == maskCount(b) + 1;
+}
+
+/* hash of masks for unordered containers */
+struct maskHash{
+  std::size_t operator()(mask64 m) const{
+    return std::hash<mask64>()(m);
+  }
+#ifdef MASK128
+  std::size_t operator()(mask128 m) const{
+    return std::hash<mask64>()((mask64) m ^ ((mask64) (m >> 64) * 0x9e3779b97f4a7c15ULL));
+  }
+#endif
+};
+
+// --------------------------------------------------
+// ------------------- vertexBits -------------------
+// --------------------------------------------------
+
+/// The correspondance between vertex labels and bit numbers.
+/// The i-th smallest label gets the bit number i, its identifier
+/// in a vertexLabels table.
+class vertexBits
+{
+public:
+	/// Collects the vertex labels of the given simpleces (a list of
+	/// vectors or a chainTable).
+	template <class chainList>
+	explicit vertexBits (const chainList &simpleces);
+
+	/// Returns the bit number of the label or -1 if not a vertex.
+	int bit (int label) const;
+
+	/// Returns the label of the bit number.
+	int label (int bit) const;
+
+	/// Returns the number of vertrices.
+	int size () const;
+
+private:
+	/// The vertex labels and their bit numbers.
+	vertexLabels labels;
+
+}; /* class vertexBits */
+
+template <class chainList>
+inline vertexBits::vertexBits (const chainList &simpleces)
+{
+	std::vector<int> points;
+	for (int i = 0; i < chainCount (simpleces); ++ i)
+		points. insert (points. end (), chainBegin (simpleces, i),
+			chainEnd (simpleces, i));
+	labels = vertexLabels (points);
+	return;
+} /* vertexBits::vertexBits */
+
+inline int vertexBits::bit (int l) const
+{
+	// the identity table of no simplex knows no vertex
+	int b = labels. id (l);
+	return ((b >= 0) && (b < size ())) ? b : -1;
+} /* vertexBits::bit */
+
+inline int vertexBits::label (int b) const
+{
+	return labels. label (b);
+} /* vertexBits::label */
+
+inline int vertexBits::size () const
+{
+	return labels. size ();
+} /* vertexBits::size */
+
+/* width of the masks for a complex with n vertrices, 0 for the vector version */
+inline int maskWidth(int n){
+#if SIMPLEXMASK >= 64
+  if (n <= 64) return 64;
+#endif
+#ifdef MASK128
+  if (n <= 128) return 128;
+#endif
+  return 0;
+}
+
+// --------------------------------------------------
+// --------------- faces and boundary ---------------
+// --------------------------------------------------
+
+/* bitmask of a simplex given as the vertex list [first, last) */
+template <class word>
+inline word simplexToMask(const int* first,const int* last,const vertexBits& bits){
+  word m = 0;
+  for (const int* v = first; v != last; ++v)
+    {
+      m |= maskBit<word>(bits.bit(*v));
+    }
+  return m;
+}
+
+/* bitmask of a simplex given as a vertex list */
+template <class word>
+inline word simplexToMask(const std::vector<int>& simplex,const vertexBits& bits){
+  return simplexToMask<word>(simplex.data(),simplex.data() + simplex.size(),bits);
+}
+
+/*
+  every nonempty face of each chain (or simplex) exactly once.
+  the faces of a chain are the submasks of its mask, and the vertrices
+  of a face are listed in the same order as in the chain.
+*/
+template <class word,class chainList>
+void enumerateFacesByMask(const chainList& maximalChains,const vertexBits& bits,std::vector<std::vector<int>>& faceList){
+  std::unordered_set<word,maskHash> seen;
+  std::vector<int> face;
+  for (int i = 0; i < chainCount(maximalChains); ++i)
+    {
+      const int* first = chainBegin(maximalChains,i);
+      const int* last = chainEnd(maximalChains,i);
+      word m = simplexToMask<word>(first,last,bits);
+      for (word sub = m; sub != 0; sub = (sub - 1) & m)
+        {
+          if (!seen.insert(sub).second)
+            {
+              continue;
+            }
+          face.clear();
+          for (const int* v = first; v != last; ++v)
+            {
+              if (maskIsIn(sub,bits.bit(*v)))
+                {
+                  face.push_back(*v);
+                }
+            }
+          faceList.push_back(face);
+        }
+    }
+}
+
+/*
+  calls f(i,j,k) for every codimension one face i of the j-th simplex,
+  where the face is made by deleting the k-th smallest vertex.
+  a face is the mask with one bit cleared.
+*/
+template <class word,class function>
+void forEachFaceByMask(const std::vector<std::vector<int>>& simpleces,const vertexBits& bits,function f){
+  std::vector<word> masks(simpleces.size());
+  std::unordered_map<word,int,maskHash> index;
+  index.reserve(simpleces.size());
+  for (int i = 0; i < simpleces.size(); ++i)
+    {
+      masks[i] = simplexToMask<word>(simpleces[i],bits);
+      index.insert(std::make_pair(masks[i],i));
+    }
+  for (int j = 0; j < simpleces.size(); ++j)
+    {
+      word m = masks[j];
+      if (maskCount(m) < 2)
+        {
+          continue;
+        }
+      int k = 0;
+      for (word rest = m; rest != 0; rest &= rest - 1, ++k)
+        {
+          word face = m & ~(rest & (~rest + 1));
+          typename std::unordered_map<word,int,maskHash>::const_iterator it = index.find(face);
+          if (it != index.end())
+            {
+              f(it->second,j,k);
+            }
+        }
+    }
+}
+
+#endif
@@ -40,12 +40,24 @@
 #include <fstream>
 #include <cstdlib>
 #include <iomanip>
+#include <sstream>
 #include <algorithm>
 #include <array>
+#include <thread>
+#include <atomic>
+#include <unordered_map>
 #include "poset_convert.h"
+#include "Z2integer.h"
 #define CHAINFIXED 1
+
+/// The number of simpleces below which the whitney chain is built
+/// in one thread.
+#ifndef PARALLELSIMPLECES
+#define PARALLELSIMPLECES 1024
+#endif
 class outputstream;
-class chain;
+template <class euclidom> class coefficients;
+template <class euclidom> class chain;
 
 // --------------------------------------------------
 // ----------------- various tools ------------------
@@ -305,8 +317,73 @@ inline outputstream &operator << (outputstream &out,
 #endif
 
 
+// --------------------------------------------------
+// ------------------ coefficients ------------------
+// --------------------------------------------------
+
+/// This class defines the access to the table of coefficients
+/// which a chain keeps next to the table of identifiers.
+template <class euclidom>
+class coefficients
+{
+public:
+	/// Allocates a table of the given length.
+	static euclidom *allocate (int len)
+	{
+		return new euclidom [len];
+	}
+
+	/// Releases a table allocated with 'allocate'.
+	static void release (euclidom *tab)
+	{
+		delete [] tab;
+	}
+
+	/// Returns the i-th coefficient in the table.
+	static euclidom get (const euclidom *tab, int i)
+	{
+		return tab [i];
+	}
+
+	/// Sets the i-th coefficient in the table.
+	static void set (euclidom *tab, int i, const euclidom &e)
+	{
+		tab [i] = e;
+	}
+}; /* class coefficients */
 
+/// Over Z_2 every coefficient kept in a chain equals 1, so no table
+/// is allocated and the access to the coefficients compiles away.
+template <>
+class coefficients<GF2>
+{
+public:
+	static GF2 *allocate (int)
+	{
+		return NULL;
+	}
+
+	static void release (GF2 *)
+	{
+		return;
+	}
 
+	static GF2 get (const GF2 *, int)
+	{
+		return GF2 (1);
+	}
+
+	static void set (GF2 *, int, const GF2 &)
+	{
+		return;
+	}
+}; /* class coefficients */
+
+
+/// This class defines objects which represent chains as finite sequences
+/// of elements identified by integral numbers with coefficients
+/// in a given field.
+template <class euclidom>
 class chain
 {
 public:
@@ -319,6 +396,12 @@ public:
 	/// The assignment operator.
 	chain &operator = (const chain &c);
 
+	/// The move constructor. Takes the tables of the other chain.
+	chain (chain &&c);
+
+	/// The move assignment operator. Takes the tables of the other chain.
+	chain &operator = (chain &&c);
+
 	/// The destructor.
 	~chain ();
 
@@ -331,16 +414,15 @@ public:
 	/// Finds and returns the coefficient in front of the given element.
 	/// If the identifier is negative, then returns the first nonzero
 	/// coefficient or 0 if none.
-	Z2integer getcoefficient (int n = -1) const;
+	euclidom getcoefficient (int n = -1) const;
 
 	/// Find the position of an element with the given identifier.
 	/// Returns -1 if not found.
 	int findnumber (int n) const;
 
-        bool isContainNumber(chain chain,int n);
 	/// Returns the coefficient in front of the i-th element
 	/// in the chain.
-	Z2integer coef (int i) const;
+	euclidom coef (int i) const;
 
 	/// Returns the number (identifier) of the i-th element in the chain.
 	int num (int i) const;
@@ -358,7 +440,7 @@ public:
 	int findbest (chain *table = NULL) const;
 
 	/// Adds an element algebraically to the chain.
-	chain &add (int n, Z2integer e);
+	chain &add (int n, euclidom e = euclidom (1));
 
 	/// Removes an element with the given identifier from the chain.
 	chain &remove (int n);
@@ -368,7 +450,7 @@ public:
 	/// table of columns must be given for proper modification.
 	/// If this is a column, its number and columns must be given.
 	chain &add (const chain &other,
-                    Z2integer e = (Z2integer) 1, int number = -1,
+                    euclidom e = euclidom (1), int number = -1,
 		chain *table = NULL);
 
 	/// Swaps one chain with another. If the chain is a row of a
@@ -385,16 +467,7 @@ public:
 
 	/// Multiplies one or all the coefficients in the chain
 	/// by the given number.
-	chain &multiply (Z2integer e, int number = -1);
-
-        void showChainAsVertex(std::vector<std::vector<int>> simpleces,std::vector<chain> chainList,bool homFlag, int homDim);
-
-        /* for making the chain which represents whitney classes without subivision. */
-        bool isExistSmaller(int g,std::vector<int> sigma,std::vector<int> vertexSet,std::vector<std::array<int,2>> arrowList /* int arrowList[][2] */,int numberOfArrows);
-        bool isExistBigger(int l,std::vector<int> sigma,std::vector<int> vertexSet,std::vector<std::array<int,2>> arrowList /* int arrowList[][2] */,int numberOfArrows);
-        bool isExistBitween(int l,int g,std::vector<int> sigma,std::vector<int> vertexSet,std::vector<std::array<int,2>> arrowList /* int arrowList[][2] */,int numberOfArrows);
-        bool isRegular(std::vector<int> sigma,std::vector<int> tau);
-        chain makeWhitneyChain(int p,std::vector<std::vector<int>> simpleces);
+	chain &multiply (euclidom e, int number = -1);
 
 	/// Shows the chain to the output stream. Uses a given label
 	/// for indicating identifiers of elements in the chain.
@@ -406,6 +479,9 @@ public:
 	std::ostream &show (std::ostream &out, const char *label = NULL) const;
 
 private:
+	/// The access to the tables of coefficients.
+	typedef coefficients<euclidom> ctab;
+
 	/// The length of the list and the length of the table.
 	int len;
 
@@ -418,22 +494,22 @@ private:
 		struct
 		{
 			int *n;
-			Z2integer *e;
+			euclidom *e;
 		} t;
 		struct
 		{
 			#if CHAINFIXED
 			int n [CHAINFIXED];
-			Z2integer e [CHAINFIXED];
+			euclidom e [CHAINFIXED];
 			#else
 			int *n;
-			Z2integer *e;
+			euclidom *e;
 			#endif
 		} x;
 	};
 
 	/// Inserts one chain element at the given position.
-	chain &insertpair (int i, int n, Z2integer e);
+	chain &insertpair (int i, int n, euclidom e);
 
 	/// Removes one chain element at the given position.
 	chain &removepair (int i);
@@ -448,6 +524,9 @@ private:
 
 }; /* class chain */
 
+/// The chains with coefficients in Z_2.
+typedef chain<Z2integer> Z2chain;
+
 
 // --------------------------------------------------
 /// Ignores the input characters until the end of a line, including this
@@ -518,25 +597,28 @@ inline int readparenthesis (std::istream &in)
 
 
 
-inline bool chain::allocated () const
+template <class euclidom>
+inline bool chain<euclidom>::allocated () const
 {
 	if (len <= static_cast<int> (CHAINFIXED))
 		return false;
-//	return (sizeof (int *) < ((sizeof (int) < sizeof (Z2integer)) ?
-//		sizeof (Z2integer) : sizeof (int)) * len);
+//	return (sizeof (int *) < ((sizeof (int) < sizeof (euclidom)) ?
+//		sizeof (euclidom) : sizeof (int)) * len);
 	else
 		return true;
 } /* chain::allocated */
 
 
-inline chain::chain ()
+template <class euclidom>
+inline chain<euclidom>::chain ()
 {
 	len = 0;
 	return;
 } /* chain::chain */
 
 
-inline chain::chain (const chain &c)
+template <class euclidom>
+inline chain<euclidom>::chain (const chain &c)
 {
 	// copy the length of the chain
 	len = c. len;
@@ -545,13 +627,13 @@ inline chain::chain (const chain &c)
 	if (allocated ())
 	{
 		t. n = new int [len];
-		t. e = new Z2integer [len];
-		if (!t. n || !t. e)
+		t. e = ctab::allocate (len);
+		if (!t. n)
 			throw "Not enough memory to create a chain copy.";
 		for (int i = 0; i < len; ++ i)
 		{
 			t. n [i] = c. t. n [i];
-			t. e [i] = c. t. e [i];
+			ctab::set (t. e, i, ctab::get (c. t. e, i));
 		}
 	}
 	else
@@ -559,14 +641,15 @@ inline chain::chain (const chain &c)
 		for (int i = 0; i < len; ++ i)
 		{
 			x. n [i] = c. x. n [i];
-			x. e [i] = c. x. e [i];
+			ctab::set (x. e, i, ctab::get (c. x. e, i));
 		}
 	}
 	return;
 } /* chain::chain */
 
 
-inline chain &chain::operator =
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::operator =
 	(const chain &c)
 {
 	// protect against self-assignment
@@ -577,7 +660,7 @@ inline chain &chain::operator =
 	if (allocated ())
 	{
 		delete [] t. n;
-		delete [] t. e;
+		ctab::release (t. e);
 	}
 
 	// copy the length of the chain
@@ -587,13 +670,13 @@ inline chain &chain::operator =
 	if (allocated ())
 	{
 		t. n = new int [len];
-		t. e = new Z2integer [len];
-		if (!t. n || !t. e)
+		t. e = ctab::allocate (len);
+		if (!t. n)
 			throw "Not enough memory to create a chain copy =.";
 		for (int i = 0; i < len; ++ i)
 		{
 			t. n [i] = c. t. n [i];
-			t. e [i] = c. t. e [i];
+			ctab::set (t. e, i, ctab::get (c. t. e, i));
 		}
 	}
 	else
@@ -601,47 +684,69 @@ inline chain &chain::operator =
 		for (int i = 0; i < len; ++ i)
 		{
 			x. n [i] = c. x. n [i];
-			x. e [i] = c. x. e [i];
+			ctab::set (x. e, i, ctab::get (c. x. e, i));
 		}
 	}
 	return *this;
 } /* chain::operator = */
 
 
-inline chain::~chain ()
+template <class euclidom>
+inline chain<euclidom>::chain (chain &&c)
+{
+	len = 0;
+	take (c);
+	return;
+} /* chain::chain */
+
+
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::operator = (chain &&c)
+{
+	if (&c != this)
+		take (c);
+	return *this;
+} /* chain::operator = */
+
+
+template <class euclidom>
+inline chain<euclidom>::~chain ()
 {
 	if (allocated ())
 	{
 		delete [] t. n;
-		delete [] t. e;
+		ctab::release (t. e);
 	}
 	return;
 } /* chain::~chain */
 
 
-inline int chain::size () const
+template <class euclidom>
+inline int chain<euclidom>::size () const
 {
 	return len;
 } /* chain::size */
 
 
-inline bool chain::empty () const
+template <class euclidom>
+inline bool chain<euclidom>::empty () const
 {
 	return !len;
 } /* chain::empty */
 
 
-/*inline*/ Z2integer chain::getcoefficient (int n) const
+template <class euclidom>
+/*inline*/ euclidom chain<euclidom>::getcoefficient (int n) const
 {
 	bool a = allocated ();
-	const Z2integer *tetab = a ? t. e : x. e;
+	const euclidom *tetab = a ? t. e : x. e;
 	if (n < 0)
 	{
 		if (len > 0)
-			return tetab [0];
+			return ctab::get (tetab, 0);
 		else
 		{
-			Z2integer zero;
+			euclidom zero;
 			zero = 0;
 			return zero;
 		}
@@ -653,14 +758,15 @@ inline bool chain::empty () const
 		++ i;
 	if ((i >= len) || (tntab [i] != n))
 	{
-		Z2integer zero;
+		euclidom zero;
 		zero = 0;
 		return zero;
 	}
-	return tetab [i];
+	return ctab::get (tetab, i);
 } /* chain::getcoefficient */
 
-inline int chain::findnumber (int n) const
+template <class euclidom>
+inline int chain<euclidom>::findnumber (int n) const
 {
 	bool a = allocated ();
 	const int *tntab = a ? t. n : x. n;
@@ -674,23 +780,17 @@ inline int chain::findnumber (int n) const
 	return -1;
 } /* chain::findnumber */
 
-inline bool isContainNumber(chain chain,int n){
-  for (int i = 0; i < chain.size(); ++i)
-    {
-      if (chain.num(i)==n-1) return true;
-    }
-  return false;
-}
-
-inline Z2integer chain::coef (int i) const
+template <class euclidom>
+inline euclidom chain<euclidom>::coef (int i) const
 {
 	if (i >= len)
 		throw "Wrong coefficient requested from a chain.";
-	return (allocated () ? t. e : x. e) [i];
+	return ctab::get (allocated () ? t. e : x. e, i);
 } /* chain::coef */
 
 
-inline int chain::num (int i) const
+template <class euclidom>
+inline int chain<euclidom>::num (int i) const
 {
 	if (i >= len)
 		throw "Wrong number requested from a chain.";
@@ -698,13 +798,14 @@ inline int chain::num (int i) const
 } /* chain::num */
 
 
-inline bool chain::contains_non_invertible () const
+template <class euclidom>
+inline bool chain<euclidom>::contains_non_invertible () const
 {
 	if (allocated ())
 	{
 		for (int i = 0; i < len; ++ i)
 		{
-			if (t. e [i]. delta () > 1)
+			if (ctab::get (t. e, i). delta () > 1)
 				return true;
 		}
 	}
@@ -712,7 +813,7 @@ inline bool chain::contains_non_invertible () const
 	{
 		for (int i = 0; i < len; ++ i)
 		{
-			if (x. e [i]. delta () > 1)
+			if (ctab::get (x. e, i). delta () > 1)
 				return true;
 		}
 	}
@@ -720,7 +821,8 @@ inline bool chain::contains_non_invertible () const
 } /* chain::contains_non_invertible */
 
 
-inline int chain::findbest (chain *table) const
+template <class euclidom>
+inline int chain<euclidom>::findbest (chain *table) const
 {
 	// if the chain is so short that the answer is obvious, return it
 	if (len <= 1)
@@ -733,12 +835,12 @@ inline int chain::findbest (chain *table) const
 	// go through the whole table
 	bool a = allocated ();
 	const int *tntab = a ? t. n : x. n;
-	const Z2integer *tetab = a ? t. e : x. e;
+	const euclidom *tetab = a ? t. e : x. e;
 	int i;
 	for (i = 0; i < len; ++ i)
 	{
 		// compute the value of the function delta
-		this_delta = tetab [i]. delta ();
+		this_delta = ctab::get (tetab, i). delta ();
 
 		// if the value is the smallest possible
 		// and no further analysis was required, finish here
@@ -762,7 +864,7 @@ inline int chain::findbest (chain *table) const
 		table [tntab [best_i]]. size ();
 	for (i = best_i + 1; i < len; ++ i)
 	{
-		if (tetab [i]. delta () == best_delta)
+		if (ctab::get (tetab, i). delta () == best_delta)
 		{
 			this_length =
 				table [tntab [i]]. size ();
@@ -780,8 +882,9 @@ inline int chain::findbest (chain *table) const
 // --------------------------------------------------
 
 
-inline chain &chain::insertpair
-	(int i, int n, Z2integer e)
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::insertpair
+	(int i, int n, euclidom e)
 {
 	// remember if the table was previously allocated or not
 	bool a = allocated ();
@@ -797,34 +900,34 @@ inline chain &chain::insertpair
 	{
 		// allocate a new table
 		int *newntab = new int [len];
-		Z2integer *newetab = new Z2integer [len];
-		if (!newntab || !newetab)
+		euclidom *newetab = ctab::allocate (len);
+		if (!newntab)
 			throw "Cannot add an element to a chain.";
 
 		// determine the addresses of the old tables
 		int *oldntab = a ? t. n : x. n;
-		Z2integer *oldetab = a ? t. e : x. e;
+		euclidom *oldetab = a ? t. e : x. e;
 
 		// copy the old data and insert the new pair
 		int j;
 		for (j = 0; j < i; ++ j)
 		{
 			newntab [j] = oldntab [j];
-			newetab [j] = oldetab [j];
+			ctab::set (newetab, j, ctab::get (oldetab, j));
 		}
 		newntab [i] = n;
-		newetab [i] = e;
+		ctab::set (newetab, i, e);
 		for (j = i + 1; j < len; ++ j)
 		{
 			newntab [j] = oldntab [j - 1];
-			newetab [j] = oldetab [j - 1];
+			ctab::set (newetab, j, ctab::get (oldetab, j - 1));
 		}
 
 		// release the previous tables if they were allocated
 		if (a)
 		{
 			delete [] t. n;
-			delete [] t. e;
+			ctab::release (t. e);
 		}
 
 		// take the new tables to the data structure
@@ -838,17 +941,18 @@ inline chain &chain::insertpair
 		for (int j = len - 1; j > i; -- j)
 		{
 			x. n [j] = x. n [j - 1];
-			x. e [j] = x. e [j - 1];
+			ctab::set (x. e, j, ctab::get (x. e, j - 1));
 		}
 		x. n [i] = n;
-		x. e [i] = e;
+		ctab::set (x. e, i, e);
 	}
 
 	return *this;
 } /* chain::insertpair */
 
 
-inline chain &chain::removepair (int i)
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::removepair (int i)
 {
 	// remember if the table was previously allocated or not
 	bool a = allocated ();
@@ -864,8 +968,8 @@ inline chain &chain::removepair (int i)
 	if (na)
 	{
 		int *newntab = new int [len];
-		Z2integer *newetab = new Z2integer [len];
-		if (!newntab || !newetab)
+		euclidom *newetab = ctab::allocate (len);
+		if (!newntab)
 			throw "Cannot remove a pair from a chain.";
 
 		// copy the data form the previous tables
@@ -873,15 +977,15 @@ inline chain &chain::removepair (int i)
 		for (j = 0; j < i; ++ j)
 		{
 			newntab [j] = t. n [j];
-			newetab [j] = t. e [j];
+			ctab::set (newetab, j, ctab::get (t. e, j));
 		}
 		for (j = i; j < len; ++ j)
 		{
 			newntab [j] = t. n [j + 1];
-			newetab [j] = t. e [j + 1];
+			ctab::set (newetab, j, ctab::get (t. e, j + 1));
 		}
 		delete [] t. n;
-		delete [] t. e;
+		ctab::release (t. e);
 		t. n = newntab;
 		t. e = newetab;
 	}
@@ -890,26 +994,26 @@ inline chain &chain::removepair (int i)
 	else
 	{
 		int *oldntab = a ? t. n : x. n;
-		Z2integer *oldetab = a ? t. e : x. e;
+		euclidom *oldetab = a ? t. e : x. e;
 
 		// copy the data form the previous tables
 		int j;
 		for (j = 0; a && (j < i); ++ j)
 		{
 			x. n [j] = oldntab [j];
-			x. e [j] = oldetab [j];
+			ctab::set (x. e, j, ctab::get (oldetab, j));
 		}
 		for (j = i; j < len; ++ j)
 		{
 			x. n [j] = oldntab [j + 1];
-			x. e [j] = oldetab [j + 1];
+			ctab::set (x. e, j, ctab::get (oldetab, j + 1));
 		}
 
 		// release the old tables if necessary
 		if (a)
 		{
 			delete [] oldntab;
-			delete [] oldetab;
+			ctab::release (oldetab);
 		}
 	}
 
@@ -919,7 +1023,8 @@ inline chain &chain::removepair (int i)
 
 // --------------------------------------------------
 
-inline chain &chain::swapnumbers (int number1,
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::swapnumbers (int number1,
 	int number2)
 {
 	// if the numbers are the same, do nothing
@@ -933,7 +1038,7 @@ inline chain &chain::swapnumbers (int number1,
 	// determine the true tables to be processed
 	bool a = allocated ();
 	int *tntab = a ? t. n : x. n;
-	Z2integer *tetab = a ? t. e : x. e;
+	euclidom *tetab = a ? t. e : x. e;
 
 	// find both numbers or the positions they should be at
 	int i1 = 0, i2 = 0;
@@ -947,32 +1052,36 @@ inline chain &chain::swapnumbers (int number1,
 	{
 		// if both numbers were found, exchange their coefficients
 		if ((i2 < len) && (tntab [i2] == number2))
-			swapelements (tetab [i1], tetab [i2]);
+		{
+			euclidom temp = ctab::get (tetab, i1);
+			ctab::set (tetab, i1, ctab::get (tetab, i2));
+			ctab::set (tetab, i2, temp);
+		}
 		// if only the first was found, move it to the new position
 		else
 		{
-			Z2integer temp = tetab [i1];
+			euclidom temp = ctab::get (tetab, i1);
 			for (int i = i1 + 1; i < i2; ++ i)
 			{
 				tntab [i - 1] = tntab [i];
-				tetab [i - 1] = tetab [i];
+				ctab::set (tetab, i - 1, ctab::get (tetab, i));
 			}
 			tntab [i2 - 1] = number2;
-			tetab [i2 - 1] = temp;
+			ctab::set (tetab, i2 - 1, temp);
 		}
 	}
 
 	// otherwise if the second number only was found, move it to its pos.
 	else if ((i2 < len) && (tntab [i2] == number2))
 	{
-		Z2integer temp = tetab [i2];
+		euclidom temp = ctab::get (tetab, i2);
 		for (int i = i2; i > i1; -- i)
 		{
 			tntab [i] = tntab [i - 1];
-			tetab [i] = tetab [i - 1];
+			ctab::set (tetab, i, ctab::get (tetab, i - 1));
 		}
 		tntab [i1] = number1;
-		tetab [i1] = temp;
+		ctab::set (tetab, i1, temp);
 	}
 
 	return *this;
@@ -981,14 +1090,15 @@ inline chain &chain::swapnumbers (int number1,
 
 
 
-inline chain &chain::add (int n, Z2integer e = (Z2integer)1)
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::add (int n, euclidom e)
 {
 	// if the coefficient is zero, ignore the pair
 	if (e == 0)
 		return *this;
 	bool a = allocated ();
 	int *tntab = a ? t. n : x. n;
-	Z2integer *tetab = a ? t. e : x. e;
+	euclidom *tetab = a ? t. e : x. e;
 
 	// find the position in the table for adding this pair
 	int i = 0;
@@ -999,15 +1109,15 @@ inline chain &chain::add (int n, Z2integer e = (Z2integer)1)
 	if ((i < len) && (tntab [i] == n))
 	{
 		// add the coefficient
-		tetab [i] += e;
+		euclidom sum = ctab::get (tetab, i) + e;
 
 		// if the coefficient became zero, remove this pair
-		if (tetab [i] == 0)
+		if (sum == 0)
 			return removepair (i);
 
 		// otherwise we are done
-		else
-			return *this;
+		ctab::set (tetab, i, sum);
+		return *this;
 	}
 
 	// otherwise insert this pair into the chain
@@ -1015,7 +1125,8 @@ inline chain &chain::add (int n, Z2integer e = (Z2integer)1)
 
 } /* chain::add */
 
-inline chain &chain::swap (chain &other,
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::swap (chain &other,
 	int number, int othernumber, chain *table)
 {
 	// check which chains where allocated
@@ -1037,29 +1148,31 @@ inline chain &chain::swap (chain &other,
 		for (i = 0; (i < len) && (i < other. len); ++ i)
 		{
 			swapelements (x. n [i], other. x. n [i]);
-			swapelements (x. e [i], other. x. e [i]);
+			euclidom temp = ctab::get (x. e, i);
+			ctab::set (x. e, i, ctab::get (other. x. e, i));
+			ctab::set (other. x. e, i, temp);
 		}
 
 		// copy the remaining portion of the data
 		for (i = len; i < other. len; ++ i)
 		{
 			x. n [i] = other. x. n [i];
-			x. e [i] = other. x. e [i];
+			ctab::set (x. e, i, ctab::get (other. x. e, i));
 		}
 		for (i = other. len; i < len; ++ i)
 		{
 			other. x. n [i] = x. n [i];
-			other. x. e [i] = x. e [i];
+			ctab::set (other. x. e, i, ctab::get (x. e, i));
 		}
 	}
 	else if (a) // && !oa
 	{
 		int *tempn = t. n;
-		Z2integer *tempe = t. e;
+		euclidom *tempe = t. e;
 		for (int i = 0; i < other. len; ++ i)
 		{
 			x. n [i] = other. x. n [i];
-			x. e [i] = other. x. e [i];
+			ctab::set (x. e, i, ctab::get (other. x. e, i));
 		}
 		other. t. n = tempn;
 		other. t. e = tempe;
@@ -1067,11 +1180,11 @@ inline chain &chain::swap (chain &other,
 	else // if (oa) // && !a
 	{
 		int *tempn = other. t. n;
-		Z2integer *tempe = other. t. e;
+		euclidom *tempe = other. t. e;
 		for (int i = 0; i < len; ++ i)
 		{
 			other. x. n [i] = x. n [i];
-			other. x. e [i] = x. e [i];
+			ctab::set (other. x. e, i, ctab::get (x. e, i));
 		}
 		t. n = tempn;
 		t. e = tempe;
@@ -1115,7 +1228,8 @@ inline chain &chain::swap (chain &other,
 	return *this;
 } /* chain::swap */
 
-chain &chain::remove (int n)
+template <class euclidom>
+chain<euclidom> &chain<euclidom>::remove (int n)
 {
 	bool a = allocated ();
 	int *tntab = a ? t. n : x. n;
@@ -1133,8 +1247,9 @@ chain &chain::remove (int n)
 } /* chain::remove */
 
 
-inline chain &chain::add (const chain &other,
-	Z2integer e, int number, chain *table)
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::add (const chain &other,
+	euclidom e, int number, chain *table)
 {
 	// if the coefficient is zero or the other chain is zero,
 	// then there is nothing to do
@@ -1144,8 +1259,8 @@ inline chain &chain::add (const chain &other,
 	// prepare big tables for the new chain
 	int tablen = len + other. len;
 	int *bigntab = new int [tablen];
-	Z2integer *bigetab = new Z2integer [tablen];
-	if (!bigntab || !bigetab)
+	euclidom *bigetab = ctab::allocate (tablen);
+	if (!bigntab)
 		throw "Not enough memory to add chains.";
 
 	// prepare the counters of elements of the two input chains
@@ -1156,9 +1271,9 @@ inline chain &chain::add (const chain &other,
 	bool a = allocated ();
 	bool oa = other. allocated ();
 	const int *tntab = a ? t. n : x. n;
-	const Z2integer *tetab = a ? t. e : x. e;
+	const euclidom *tetab = a ? t. e : x. e;
 	const int *ontab = oa ? other. t. n : other. x. n;
-	const Z2integer *oetab = oa ? other. t. e : other. x. e;
+	const euclidom *oetab = oa ? other. t. e : other. x. e;
 
 	// go through both input chains and compute the output chain
 	while ((i < len) || (j < other. len))
@@ -1166,38 +1281,39 @@ inline chain &chain::add (const chain &other,
 		if (i >= len)
 		{
 			bigntab [k] = ontab [j];
-			bigetab [k] = e * oetab [j ++];
+			ctab::set (bigetab, k, e * ctab::get (oetab, j ++));
 			if (table)
 			{
 				table [bigntab [k]]. add (number,
-					bigetab [k]);
+					ctab::get (bigetab, k));
 			}
 			++ k;
 		}
 		else if ((j >= other. len) || (tntab [i] < ontab [j]))
 		{
 			bigntab [k] = tntab [i];
-			bigetab [k ++] = tetab [i ++];
+			ctab::set (bigetab, k ++, ctab::get (tetab, i ++));
 		}
 		else if (tntab [i] > ontab [j])
 		{
 			bigntab [k] = ontab [j];
-			bigetab [k] = e * oetab [j ++];
+			ctab::set (bigetab, k, e * ctab::get (oetab, j ++));
 			if (table)
 			{
 				table [bigntab [k]]. add (number,
-					bigetab [k]);
+					ctab::get (bigetab, k));
 			}
 			++ k;
 		}
 		else // if (tntab [i] == ontab [j])
 		{
 			bigntab [k] = tntab [i];
-			Z2integer addelem = e * oetab [j ++];
-			bigetab [k] = tetab [i ++] + addelem;
-			Z2integer zero;
+			euclidom addelem = e * ctab::get (oetab, j ++);
+			euclidom sum = ctab::get (tetab, i ++) + addelem;
+			ctab::set (bigetab, k, sum);
+			euclidom zero;
 			zero = 0;
-			if (bigetab [k] != zero)
+			if (sum != zero)
 			{
 				if (table)
 				{
@@ -1217,7 +1333,7 @@ inline chain &chain::add (const chain &other,
 	if (a && ((k != len) || (k == tablen)))
 	{
 		delete [] t. n;
-		delete [] t. e;
+		ctab::release (t. e);
 	}
 
 	// use the previous tables and release the big table if beneficial
@@ -1226,10 +1342,10 @@ inline chain &chain::add (const chain &other,
 		for (int i = 0; i < len; ++ i)
 		{
 			t. n [i] = bigntab [i];
-			t. e [i] = bigetab [i];
+			ctab::set (t. e, i, ctab::get (bigetab, i));
 		}
 		delete [] bigntab;
-		delete [] bigetab;
+		ctab::release (bigetab);
 		return *this;
 	}
 
@@ -1241,10 +1357,10 @@ inline chain &chain::add (const chain &other,
 		for (int i = 0; i < len; ++ i)
 		{
 			x. n [i] = bigntab [i];
-			x. e [i] = bigetab [i];
+			ctab::set (x. e, i, ctab::get (bigetab, i));
 		}
 		delete [] bigntab;
-		delete [] bigetab;
+		ctab::release (bigetab);
 		return *this;
 	}
 
@@ -1252,16 +1368,16 @@ inline chain &chain::add (const chain &other,
 	if (len != tablen)
 	{
 		t. n = new int [len];
-		t. e = new Z2integer [len];
-		if (!t. n || !t. e)
+		t. e = ctab::allocate (len);
+		if (!t. n)
 			throw "Cannot shorten a sum of chains.";
 		for (int i = 0; i < len; ++ i)
 		{
 			t. n [i] = bigntab [i];
-			t. e [i] = bigetab [i];
+			ctab::set (t. e, i, ctab::get (bigetab, i));
 		}
 		delete [] bigntab;
-		delete [] bigetab;
+		ctab::release (bigetab);
 	}
 
 	// otherwise, simply use the big tables
@@ -1277,13 +1393,14 @@ inline chain &chain::add (const chain &other,
 
 
 
-inline chain &chain::take (chain &c)
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::take (chain &c)
 {
 	// release the current tables if they were allocated
 	if (allocated ())
 	{
 		delete [] t. n;
-		delete [] t. e;
+		ctab::release (t. e);
 	}
 
 	// if the other tables were allocated, take them
@@ -1299,7 +1416,7 @@ inline chain &chain::take (chain &c)
 		for (int i = 0; i < c. len; ++ i)
 		{
 			x. n [i] = c. x. n [i];
-			x. e [i] = c. x. e [i];
+			ctab::set (x. e, i, ctab::get (c. x. e, i));
 		}
 	}
 
@@ -1311,12 +1428,13 @@ inline chain &chain::take (chain &c)
 } /* chain::take */
 
 
-inline chain &chain::multiply (Z2integer e, int number)
+template <class euclidom>
+inline chain<euclidom> &chain<euclidom>::multiply (euclidom e, int number)
 {
 	// check if the tables have been allocated or not
 	bool a = allocated ();
 	int *tntab = a ? t. n : x. n;
-	Z2integer *tetab = a ? t. e : x. e;
+	euclidom *tetab = a ? t. e : x. e;
 
 	// if there is only one element to be multiplied, find it and do it
 	if (number >= 0)
@@ -1329,8 +1447,8 @@ inline chain &chain::multiply (Z2integer e, int number)
 					removepair (i);
 				else
 				{
-					tetab [i] *= e;
-				//	if (tetab [i] == 0)
+					ctab::set (tetab, i, ctab::get (tetab, i) * e);
+				//	if (ctab::get (tetab, i) == 0)
 				//		removepair (i);
 				}
 				return *this;
@@ -1343,8 +1461,8 @@ inline chain &chain::multiply (Z2integer e, int number)
 	{
 		for (int i = 0; i < len; ++ i)
 		{
-			tetab [i] *= e;
-			if (tetab [i] == 0)
+			ctab::set (tetab, i, ctab::get (tetab, i) * e);
+			if (ctab::get (tetab, i) == 0)
 				removepair (i);
 		}
 	}
@@ -1355,7 +1473,7 @@ inline chain &chain::multiply (Z2integer e, int number)
 		if (a)
 		{
 			delete [] t. n;
-			delete [] t. e;
+			ctab::release (t. e);
 		}
 		len = 0;
 	}
@@ -1364,14 +1482,24 @@ inline chain &chain::multiply (Z2integer e, int number)
 } /* chain::multiply */
 
 
-inline void showChainAsVertex(std::vector<std::vector<int>> simpleces,std::vector<chain> chainList, bool homFlag = false,int homDim = -1){
+template <class euclidom>
+inline bool isContainNumber(const chain<euclidom>& chain,int n){
+  for (int i = 0; i < chain.size(); ++i)
+    {
+      if (chain.num(i)==n-1) return true;
+    }
+  return false;
+}
+
+template <class euclidom>
+inline void showChainAsVertex(const std::vector<std::vector<int>>& simpleces,const std::vector<chain<euclidom>>& chainList, bool homFlag = false,int homDim = -1,const vertexLabels &labels = vertexLabels()){
   if(chainList.empty()){
     std::cout <<"None"<< std::endl;
     std::cout << std::endl;
   } else {
     for (int k = 0 ; k < chainList.size(); ++k)
       {
-        chain z = chainList[k];
+        chain<euclidom> z = chainList[k];
         int size = z.size();
         if (homFlag && homDim != -1)
           {
@@ -1383,35 +1511,39 @@ inline void showChainAsVertex(std::vector<std::vector<int>> simpleces,std::vecto
               {
                 std::cout << std::setw(8 + (k+1) / 10 + 1 + (homDim/10) + 1 ) << std::setfill(' ') << std::right << std::flush;
               }
-            std::cout <<"1*{"<< std::flush;
+            std::stringstream coefficient;
+            coefficient << z.coef(i) << "*{";
+            std::cout << coefficient.str() << std::flush;
             for (int j = 0 ; j < simpleces[z.num(i)-1].size()-1; ++j)
               {
-                std::cout << simpleces[z.num(i)-1][j] <<"," << std::flush;
+                std::cout << labels.label(simpleces[z.num(i)-1][j]) <<"," << std::flush;
               }
-            std::cout <<  (simpleces[z.num(i)-1])[simpleces[z.num(i)-1].size()-1] << "}+"<< std::endl;
+            std::cout <<  labels.label((simpleces[z.num(i)-1])[simpleces[z.num(i)-1].size()-1]) << "}+"<< std::endl;
           }
         if (homFlag && homDim != -1 && size != 1)
           {
             std::cout << std::setw(8 + (k+1) / 10 + 1 + (homDim/10) + 1 ) << std::setfill(' ') << std::right << std::flush;
           }
-        std::cout  <<"1*{"<< std::flush;
+        std::stringstream coefficient;
+        coefficient << z.coef(size - 1) << "*{";
+        std::cout  << coefficient.str() << std::flush;
         for (int j = 0; j < simpleces[z.num(size - 1)-1].size()-1; ++j)
           {
-            std::cout << simpleces[z.num(size - 1)-1][j] <<"," << std::flush;
+            std::cout << labels.label(simpleces[z.num(size - 1)-1][j]) <<"," << std::flush;
           }
-        std::cout << (simpleces[z.num(size - 1)-1])[simpleces[z.num(size - 1)-1].size()-1] << "}"<< std::endl;
+        std::cout << labels.label((simpleces[z.num(size - 1)-1])[simpleces[z.num(size - 1)-1].size()-1]) << "}"<< std::endl;
         std::cout << std::endl;
       }
   }
   /* std::cout << std::endl; */
 }
 
-bool isExistSmaller(int g,std::vector<int> sigma,std::vector<int> vertexSet,std::vector<std::array<int,2>> arrowList /* int arrowList[][2] */,int numberOfArrows)
+bool isExistSmaller(int g,const std::vector<int>& sigma,const orderIndex& order)
 {
   for (auto x:sigma)
     {
       /* x < g */
-      if (greater(x,g,vertexSet,arrowList,numberOfArrows))
+      if (greater(x,g,order))
         {
           return true;
         }
@@ -1419,12 +1551,12 @@ bool isExistSmaller(int g,std::vector<int> sigma,std::vector<int> vertexSet,std:
   return false;
 }
 
-bool isExistBigger(int l,std::vector<int> sigma,std::vector<int> vertexSet,std::vector<std::array<int,2>> arrowList /* int arrowList[][2] */,int numberOfArrows)
+bool isExistBigger(int l,const std::vector<int>& sigma,const orderIndex& order)
 {
   for (auto x:sigma)
     {
       /* x > l */
-      if (greater(l,x,vertexSet,arrowList,numberOfArrows))
+      if (greater(l,x,order))
         {
           return true;
         }
@@ -1432,12 +1564,12 @@ bool isExistBigger(int l,std::vector<int> sigma,std::vector<int> vertexSet,std::
   return false;
 }
 
-bool isExistBitween(int l,int g,std::vector<int> sigma,std::vector<int> vertexSet, std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows)
+bool isExistBitween(int l,int g,const std::vector<int>& sigma,const orderIndex& order)
 {
   for (auto x:sigma)
     {
       /* x < g && l < x */
-      if ((greater(x,g,vertexSet,arrowList,numberOfArrows) && greater(l,x,vertexSet,arrowList,numberOfArrows)))
+      if ((greater(x,g,order) && greater(l,x,order)))
         {
           return true;
         }
@@ -1445,24 +1577,24 @@ bool isExistBitween(int l,int g,std::vector<int> sigma,std::vector<int> vertexSe
   return false;
 }
 
-bool isRegular(std::vector<int> sigma,std::vector<int> tau,std::vector<int> vertexSet,std::vector<std::array<int,2>> arrowList /* int arrowList[][2] */,int numberOfArrows)
+/* the order conditions of isRegular, for sigma already known to be a face of tau */
+bool isRegularFace(const std::vector<int>& sigma,const std::vector<int>& tau,const orderIndex& order)
 {
-  if (!isSubset(tau,sigma)) return false;
   /*if number of tau's int which is less than sigma[0] is nonzero return false*/
-  if (isExistSmaller(sigma[0],tau,vertexSet,arrowList,numberOfArrows))
+  if (isExistSmaller(sigma[0],tau,order))
     {
       return false;
     }
   for (int i = 1; i < sigma.size()-1; i += 2)
     {
       /*if number of tau's int which is between than sigma[i] and sigma[i+1] is nonzero return false*/
-      if(isExistBitween(sigma[i],sigma[i+1],tau,vertexSet,arrowList,numberOfArrows)){
+      if(isExistBitween(sigma[i],sigma[i+1],tau,order)){
         return false;
       }
     }
   if (sigma.size() % 2 == 0)
     {
-      if (isExistBigger(sigma[sigma.size()-1],tau,vertexSet,arrowList,numberOfArrows))
+      if (isExistBigger(sigma[sigma.size()-1],tau,order))
         {
           return false;
         }
@@ -1470,10 +1602,23 @@ bool isRegular(std::vector<int> sigma,std::vector<int> tau,std::vector<int> vert
   return true;
 }
 
+bool isRegular(const std::vector<int>& sigma,const std::vector<int>& tau,const orderIndex& order)
+{
+  return isSubset(tau,sigma) && isRegularFace(sigma,tau,order);
+}
+
 
-inline chain makeWhitneyChain(int p,std::vector<std::vector<int>> simpleces,std::vector<int> vertexSet,std::vector<std::array<int,2>> arrowList /* int arrowList[][2] */,int numberOfArrows)
+inline chain<Z2integer> makeWhitneyChain(int p,const std::vector<std::vector<int>>& simpleces,const std::vector<int>& vertexSet,const std::vector<std::array<int,2>>& arrowList /* int arrowList[][2] */,int numberOfArrows)
 {
-  chain res = chain();
+  chain<Z2integer> res = chain<Z2integer>();
+  /* the order relation is looked up in the reachability index */
+  orderIndex order(HasseDiagram(arrowList,numberOfArrows));
+  /* the vertices of each simplex as a sorted set, for the face test */
+  std::vector<std::vector<int>> vertexSets(simpleces.size());
+  for (int l = beginNum(p+1,simpleces); l < simpleces.size(); ++l)
+    {
+      vertexSets[l] = sortedSet(simpleces[l]);
+    }
   /*次元が一致する simplex (sigma)についてのループ*/
   for (int k = beginNum(p+1,simpleces) ; simpleces[k].size() == p+1; ++k)
     {
@@ -1481,7 +1626,7 @@ inline chain makeWhitneyChain(int p,std::vector<std::vector<int>> simpleces,std:
       for (int l = beginNum(p+1,simpleces); l < simpleces.size(); ++l)
         {
           /*sigma が tau で正則 なら 生成元なのでindexに追加（あとでmatrixで追加する都合+1）*/
-          if (isRegular(simpleces[k],simpleces[l],vertexSet,arrowList,numberOfArrows))
+          if (setIsSubset(vertexSets[l],vertexSets[k]) && isRegularFace(simpleces[k],simpleces[l],order))
             {
               res.add(k+1,(Z2integer) 1);
             }
@@ -1491,18 +1636,108 @@ inline chain makeWhitneyChain(int p,std::vector<std::vector<int>> simpleces,std:
 }
 
 
+/*
+  the whitney chain of all the dimensions at once, the sum of makeWhitneyChain(p,...)
+  for p = 0, ..., dimention-1. each sigma is tested only against its cofaces tau,
+  the intersection of the lists of simpleces containing the vertices of sigma,
+  and the simpleces sigma are shared between the threads.
+*/
+inline chain<Z2integer> makeWhitneyChain(const std::vector<std::vector<int>>& simpleces,const std::vector<std::array<int,2>>& arrowList,int numberOfArrows,int threads = 0)
+{
+  orderIndex order(HasseDiagram(arrowList,numberOfArrows));
+  /* the indices of the simpleces containing each vertex, in ascending order */
+  std::unordered_map<int,std::vector<int>> containing;
+  for (int l = 0; l < simpleces.size(); ++l)
+    {
+      for (auto v:simpleces[l])
+        {
+          containing[v].push_back(l);
+        }
+    }
+  /* regular[k] is the parity of the simpleces in which the k-th one is regular */
+  std::vector<char> regular(simpleces.size(),0);
+  /* the lists are only read by the threads */
+  const std::unordered_map<int,std::vector<int>>& index = containing;
+  std::atomic<int> next(0);
+  auto work = [&] ()
+    {
+      std::vector<int> cofaces,tmp;
+      for (int k = next++; k < simpleces.size(); k = next++)
+        {
+          const std::vector<int>& sigma = simpleces[k];
+          /* start from the shortest list */
+          const std::vector<int>* shortest = &index.at(sigma[0]);
+          for (auto v:sigma)
+            {
+              if (index.at(v).size() < shortest->size())
+                {
+                  shortest = &index.at(v);
+                }
+            }
+          cofaces = *shortest;
+          for (auto v:sigma)
+            {
+              if (&index.at(v) == shortest)
+                {
+                  continue;
+                }
+              tmp.clear();
+              setIntersection(cofaces,index.at(v),tmp);
+              cofaces.swap(tmp);
+            }
+          char parity = 0;
+          for (auto l:cofaces)
+            {
+              if (isRegularFace(sigma,simpleces[l],order))
+                {
+                  parity ^= 1;
+                }
+            }
+          regular[k] = parity;
+        }
+    };
+  if (threads <= 0)
+    {
+      threads = std::thread::hardware_concurrency();
+    }
+  if (simpleces.size() < PARALLELSIMPLECES || threads < 2)
+    {
+      threads = 1;
+    }
+  std::vector<std::thread> pool;
+  for (int i = 1; i < threads; ++i)
+    {
+      pool.push_back(std::thread(work));
+    }
+  work();
+  for (auto& th:pool)
+    {
+      th.join();
+    }
+  chain<Z2integer> res = chain<Z2integer>();
+  for (int k = 0; k < simpleces.size(); ++k)
+    {
+      if (regular[k])
+        {
+          res.add(k+1,(Z2integer) 1);
+        }
+    }
+  return res;
+}
+
 
-inline outputstream &chain::show (outputstream &out,
+template <class euclidom>
+inline outputstream &chain<euclidom>::show (outputstream &out,
 	const char *label) const
 {
 	if (len <= 0)
 		out << "0";
 	bool a = allocated ();
 	const int *tntab = a ? t. n : x. n;
-	const Z2integer *tetab = a ? t. e : x. e;
+	const euclidom *tetab = a ? t. e : x. e;
 	for (int i = 0; i < len; ++ i)
 	{
-		Z2integer e = tetab [i];
+		euclidom e = ctab::get (tetab, i);
 		int n = tntab [i] + 1;
 
 		if (e == 1)
@@ -1518,7 +1753,8 @@ inline outputstream &chain::show (outputstream &out,
 	return out;
 } /* chain::show */
 
-inline std::ostream &chain::show (std::ostream &out, const char *label) const
+template <class euclidom>
+inline std::ostream &chain<euclidom>::show (std::ostream &out, const char *label) const
 {
 	outputstream tout (out);
 	show (tout, label);
@@ -1530,7 +1766,8 @@ inline std::ostream &chain::show (std::ostream &out, const char *label) const
 /// Outputs the given chain to a standard output stream in the text mode.
 /// Warning: The operators >> and << are not symmetric for chains.
 
-inline std::ostream &operator << (std::ostream &out, const chain &c)
+template <class euclidom>
+inline std::ostream &operator << (std::ostream &out, const chain<euclidom> &c)
 {
 	c. show (out);
 	return out;
@@ -1539,7 +1776,8 @@ inline std::ostream &operator << (std::ostream &out, const chain &c)
 /// Reads a chain from a standard input stream in the text mode.
 /// Warning: The operators >> and << are not symmetric for chains.
 
-inline std::istream &operator >> (std::istream &in, chain &c)
+template <class euclidom>
+inline std::istream &operator >> (std::istream &in, chain<euclidom> &c)
 {
 	ignorecomments (in);
 	int closing = readparenthesis (in);
@@ -1548,7 +1786,7 @@ inline std::istream &operator >> (std::istream &in, chain &c)
 	while (in. peek () != closing)
 	{
 		// read the coefficient
-		Z2integer e (1);
+		euclidom e (1);
 		in >> e;
 
 		// read the multiplication symbol
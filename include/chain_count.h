@@ -0,0 +1,241 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file chain_count.h
+///
+/// This file contains the functions which count the chains of a poset
+/// by dynamic programming over its order relation, without listing them:
+/// the f-vector and the Euler characteristic of the order complex, and
+/// the parities of the chains below and above the points. The short
+/// chains of a skeleton are listed here too.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef CHAIN_COUNT_H
+#define CHAIN_COUNT_H
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <cstdint>
+#include "order_index.h"
+
+/* the points in an order in which every point comes after the smaller ones */
+inline std::vector<int> ascendingOrder(const orderIndex& order){
+  int n = order.diagram().size();
+  std::vector<int> size(n,0);
+  for (int v = 0; v < n; ++v)
+    {
+      const std::uint64_t* down = order.downSet(v);
+      for (int k = 0; k < order.words(); ++k)
+        {
+          size[v] += __builtin_popcountll(down[k]);
+        }
+    }
+  std::vector<int> points(n);
+  for (int v = 0; v < n; ++v)
+    {
+      points[v] = v;
+    }
+  /* a smaller point has a smaller down set */
+  std::stable_sort(points.begin(),points.end(),[&](int a,int b){ return size[a] < size[b]; });
+  return points;
+}
+
+/*
+  chainsEndingAt[v][k] is the number of chains of k+1 points whose biggest
+  point is v, counted modulo 2^64.
+*/
+inline void chainsEndingAt(const orderIndex& order,std::vector<std::vector<std::uint64_t>>& chains){
+  int n = order.diagram().size();
+  chains.assign(n,std::vector<std::uint64_t>());
+  for (auto v:ascendingOrder(order))
+    {
+      std::vector<std::uint64_t>& cv = chains[v];
+      cv.assign(1,1);
+      const std::uint64_t* down = order.downSet(v);
+      for (int k = 0; k < order.words(); ++k)
+        {
+          for (std::uint64_t word = down[k]; word != 0; word &= word - 1)
+            {
+              int u = k * 64 + __builtin_ctzll(word);
+              if (u == v)
+                {
+                  continue;
+                }
+              const std::vector<std::uint64_t>& cu = chains[u];
+              if (cv.size() < cu.size() + 1)
+                {
+                  cv.resize(cu.size() + 1,0);
+                }
+              for (int l = 0; l < cu.size(); ++l)
+                {
+                  cv[l+1] += cu[l];
+                }
+            }
+        }
+    }
+}
+
+/* f[k] is the number of k-simplices (chains of k+1 points) of the order complex, modulo 2^64 */
+inline std::vector<std::uint64_t> fVector(const orderIndex& order){
+  std::vector<std::vector<std::uint64_t>> chains;
+  chainsEndingAt(order,chains);
+  std::vector<std::uint64_t> f;
+  for (const auto& cv:chains)
+    {
+      if (f.size() < cv.size())
+        {
+          f.resize(cv.size(),0);
+        }
+      for (int l = 0; l < cv.size(); ++l)
+        {
+          f[l] += cv[l];
+        }
+    }
+  return f;
+}
+
+/* \sum (-1)^k f_k, the Euler characteristic of the order complex */
+inline std::int64_t eulerCharacteristic(const std::vector<std::uint64_t>& f){
+  std::uint64_t chi = 0;
+  for (int k = 0; k < f.size(); ++k)
+    {
+      chi = (k % 2 == 0) ? chi + f[k] : chi - f[k];
+    }
+  return static_cast<std::int64_t>(chi);
+}
+
+/* true if no point is below itself, i.e. the arrows make a poset */
+inline bool isAcyclic(const orderIndex& order){
+  for (int v = 0; v < order.diagram().size(); ++v)
+    {
+      if (order.isBelow(v,v))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+/* the number modulo 2 of the points of the bitset which are smaller than v */
+inline int parityBelow(const orderIndex& order,const std::vector<std::uint64_t>& bits,int v){
+  const std::uint64_t* down = order.downSet(v);
+  std::uint64_t odd = 0;
+  for (int k = 0; k < order.words(); ++k)
+    {
+      odd ^= down[k] & bits[k];
+    }
+  return __builtin_parityll(odd);
+}
+
+/* the number modulo 2 of the points of the bitset which are bigger than v */
+inline int parityAbove(const orderIndex& order,const std::vector<std::uint64_t>& bits,int v){
+  const std::uint64_t* up = order.upSet(v);
+  std::uint64_t odd = 0;
+  for (int k = 0; k < order.words(); ++k)
+    {
+      odd ^= up[k] & bits[k];
+    }
+  return __builtin_parityll(odd);
+}
+
+/*
+  the bitset of the points at which an odd number of chains ends;
+  the number of chains ending at v is 1 plus the number of chains
+  ending below v. the poset must be acyclic.
+*/
+inline std::vector<std::uint64_t> chainEndParity(const orderIndex& order){
+  std::vector<std::uint64_t> odd(order.words(),0);
+  for (auto v:ascendingOrder(order))
+    {
+      if (!parityBelow(order,odd,v))
+        {
+          odd[v >> 6] |= (std::uint64_t) 1 << (v & 63);
+        }
+    }
+  return odd;
+}
+
+/*
+  appends the chains which extend the given one by points of candidates,
+  each bigger than the last point, up to length points in all.
+*/
+inline void appendChainsAbove(const orderIndex& order,std::vector<int>& chain,const std::vector<std::uint64_t>& candidates,int length,std::vector<std::vector<int>>& result,bool& truncated){
+  for (int k = 0; k < order.words(); ++k)
+    {
+      for (std::uint64_t word = candidates[k]; word != 0; word &= word - 1)
+        {
+          int u = k * 64 + __builtin_ctzll(word);
+          if (chain.size() == length)
+            {
+              truncated = true;
+              return;
+            }
+          chain.push_back(u);
+          std::vector<int> labels;
+          for (auto v:chain)
+            {
+              labels.push_back(order.diagram().label(v));
+            }
+          result.push_back(labels);
+          std::vector<std::uint64_t> next(order.words());
+          const std::uint64_t* up = order.upSet(u);
+          for (int l = 0; l < order.words(); ++l)
+            {
+              next[l] = candidates[l] & up[l];
+            }
+          appendChainsAbove(order,chain,next,length,result,truncated);
+          chain.pop_back();
+        }
+    }
+}
+
+/*
+  the chains of at most length points of the subposet on the living points,
+  i.e. the simpleces of the (length-1)-skeleton of its order complex, in the
+  labels of the diagram from the bottom up and sorted as by simplexOrder.
+  truncated is set if a longer chain was left out.
+*/
+inline std::vector<std::vector<int>> boundedChains(const orderIndex& order,int length,const std::vector<std::uint64_t>& alive,bool& truncated){
+  std::vector<std::vector<int>> result;
+  std::vector<int> chain;
+  truncated = false;
+  appendChainsAbove(order,chain,alive,length,result,truncated);
+  std::sort(result.begin(),result.end(),[](const std::vector<int>& a,const std::vector<int>& b){
+      return (a.size() != b.size()) ? a.size() < b.size() : a < b;
+    });
+  return result;
+}
+
+inline void showFVector(const std::vector<std::uint64_t>& f){
+  std::uint64_t total = 0;
+  for (int k = 0; k < f.size(); ++k)
+    {
+      std::cout << "f_" << k << " = " << f[k] << std::endl;
+      total += f[k];
+    }
+  std::cout << std::endl;
+  std::cout << "The number of simplices: " << total << std::endl;
+  std::cout << "The Euler characteristic: " << eulerCharacteristic(f) << std::endl;
+}
+
+#endif
@@ -0,0 +1,299 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file chain_table.h
+///
+/// This file contains the class chainTable, the maximal chains of a poset
+/// kept one after another in a single array. The chains are enumerated
+/// without recursion, and the subtrees of the enumeration are shared
+/// between several threads.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef CHAIN_TABLE_H
+#define CHAIN_TABLE_H
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cstddef>
+#include "hasse_diagram.h"
+
+/// The number of chains below which the enumeration is not parallelized.
+#ifndef PARALLELCHAINS
+#define PARALLELCHAINS 4096
+#endif
+
+class chainTable;
+
+// --------------------------------------------------
+// ------------------- chainTable -------------------
+// --------------------------------------------------
+
+/// The maximal chains of a poset, from a minimal point up to a maximal
+/// one, in the order in which maximalChains() lists them. The labels of
+/// the points of all the chains are stored in one array, and the i-th
+/// chain is [begin (i), end (i)). The number of the chains and of their
+/// points is counted first, so the array is allocated once and every
+/// subtree of the enumeration writes into its own part of it.
+class chainTable
+{
+public:
+	/// The default constructor of an empty table.
+	chainTable ();
+
+	/// Enumerates the maximal chains of the diagram with the given
+	/// number of threads (0: as many as the hardware supports).
+	explicit chainTable (const HasseDiagram &hasse, int threads = 0);
+
+	/// Returns the number of chains.
+	int size () const;
+
+	/// Returns the number of points in the i-th chain.
+	int length (int i) const;
+
+	/// The labels of the points of the i-th chain.
+	const int *begin (int i) const;
+	const int *end (int i) const;
+
+	/// Appends a chain with the given labels at the end of the table.
+	void push (const int *first, const int *last);
+
+private:
+	/// The beginning of each chain in the array and the end of the last.
+	std::vector<std::size_t> offset;
+
+	/// The labels of the points of all the chains.
+	std::vector<int> points;
+
+	/// A subtree of the enumeration: the chains starting with 'first'
+	/// (and 'second' if not -1), written from the given positions.
+	struct task
+	{
+		int first;
+		int second;
+		std::size_t chain;
+		std::size_t point;
+	};
+
+	/// Writes the chains of the subtree, going up with an explicit stack
+	/// and skipping the points from which no chain was counted.
+	void enumerate (const HasseDiagram &hasse,
+		const std::vector<std::size_t> &chains, const task &t);
+
+}; /* class chainTable */
+
+// --------------------------------------------------
+
+inline chainTable::chainTable (): offset (1, 0)
+{
+	return;
+} /* chainTable::chainTable */
+
+inline chainTable::chainTable (const HasseDiagram &hasse, int threads)
+{
+	int n = hasse. size ();
+
+	// count the chains from each point up and the points in them,
+	// going down from the maximal points in a topological order;
+	// the points on a cycle are never ready and start no chain
+	std::vector<std::size_t> chains (n, 0), sizes (n, 0);
+	std::vector<int> pending (n, 0);
+	std::vector<int> ready;
+	for (int v = 0; v < n; ++ v)
+	{
+		if (!hasse. isMaximal (v))
+			pending [v] = hasse. upEnd (v) - hasse. upBegin (v);
+		if (!pending [v])
+			ready. push_back (v);
+	}
+	while (!ready. empty ())
+	{
+		int v = ready. back ();
+		ready. pop_back ();
+		if (hasse. isMaximal (v))
+		{
+			chains [v] = 1;
+			sizes [v] = 1;
+		}
+		else
+		{
+			for (const int *u = hasse. upBegin (v); u != hasse. upEnd (v); ++ u)
+			{
+				chains [v] += chains [*u];
+				sizes [v] += sizes [*u] + chains [*u];
+			}
+		}
+		for (const int *u = hasse. downBegin (v); u != hasse. downEnd (v); ++ u)
+		{
+			if (!hasse. isMaximal (*u) && !-- pending [*u])
+				ready. push_back (*u);
+		}
+	}
+
+	// split the enumeration at the points covering the minimal ones
+	std::vector<task> tasks;
+	task t = {0, -1, 0, 0};
+	for (auto m: hasse. minimalList ())
+	{
+		t. first = m;
+		if (hasse. isMaximal (m))
+		{
+			t. second = -1;
+			if (chains [m])
+				tasks. push_back (t);
+			t. chain += chains [m];
+			t. point += sizes [m];
+			continue;
+		}
+		for (const int *u = hasse. upBegin (m); u != hasse. upEnd (m); ++ u)
+		{
+			t. second = *u;
+			if (chains [*u])
+				tasks. push_back (t);
+			t. chain += chains [*u];
+			t. point += sizes [*u] + chains [*u];
+		}
+	}
+	offset. resize (t. chain + 1);
+	offset [t. chain] = t. point;
+	points. resize (t. point);
+
+	// the threads take the subtrees one by one until none is left
+	if (threads <= 0)
+		threads = std::thread::hardware_concurrency ();
+	if ((t. chain < PARALLELCHAINS) || (threads < 2))
+		threads = 1;
+	if (threads > static_cast<int> (tasks. size ()))
+		threads = tasks. size ();
+	std::atomic<std::size_t> next (0);
+	auto work = [&] ()
+	{
+		for (std::size_t k = next ++; k < tasks. size (); k = next ++)
+			enumerate (hasse, chains, tasks [k]);
+	};
+	std::vector<std::thread> pool;
+	for (int i = 1; i < threads; ++ i)
+		pool. push_back (std::thread (work));
+	work ();
+	for (auto &th: pool)
+		th. join ();
+	return;
+} /* chainTable::chainTable */
+
+inline void chainTable::enumerate (const HasseDiagram &hasse,
+	const std::vector<std::size_t> &chains, const task &t)
+{
+	std::size_t chain = t. chain;
+	std::size_t point = t. point;
+
+	// the chain from the minimal point to the top of the stack, and the
+	// next arrow to follow from each point above the fixed beginning
+	std::vector<int> path (1, t. first);
+	if (t. second != -1)
+		path. push_back (t. second);
+	std::size_t base = path. size ();
+	std::vector<const int *> next (1, hasse. upBegin (path. back ()));
+
+	while (true)
+	{
+		int v = path. back ();
+		if (hasse. isMaximal (v))
+		{
+			offset [chain ++] = point;
+			for (auto p: path)
+				points [point ++] = hasse. label (p);
+		}
+		else if (next. back () != hasse. upEnd (v))
+		{
+			int u = *next. back () ++;
+			if (chains [u])
+			{
+				path. push_back (u);
+				next. push_back (hasse. upBegin (u));
+			}
+			continue;
+		}
+		if (path. size () == base)
+			break;
+		path. pop_back ();
+		next. pop_back ();
+	}
+	return;
+} /* chainTable::enumerate */
+
+inline int chainTable::size () const
+{
+	return offset. size () - 1;
+} /* chainTable::size */
+
+inline int chainTable::length (int i) const
+{
+	return offset [i + 1] - offset [i];
+} /* chainTable::length */
+
+inline const int *chainTable::begin (int i) const
+{
+	return points. data () + offset [i];
+} /* chainTable::begin */
+
+inline const int *chainTable::end (int i) const
+{
+	return points. data () + offset [i + 1];
+} /* chainTable::end */
+
+inline void chainTable::push (const int *first, const int *last)
+{
+	points. insert (points. end (), first, last);
+	offset. push_back (points. size ());
+	return;
+} /* chainTable::push */
+
+// --------------------------------------------------
+// ------------------ chain lists -------------------
+// --------------------------------------------------
+
+/* the face kernels read the chains of a list of vectors and of a chainTable alike */
+inline int chainCount(const std::vector<std::vector<int>>& chains){
+  return chains.size();
+}
+
+inline const int* chainBegin(const std::vector<std::vector<int>>& chains,int i){
+  return chains[i].data();
+}
+
+inline const int* chainEnd(const std::vector<std::vector<int>>& chains,int i){
+  return chains[i].data() + chains[i].size();
+}
+
+inline int chainCount(const chainTable& chains){
+  return chains.size();
+}
+
+inline const int* chainBegin(const chainTable& chains,int i){
+  return chains.begin(i);
+}
+
+inline const int* chainEnd(const chainTable& chains,int i){
+  return chains.end(i);
+}
+
+#endif
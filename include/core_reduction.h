@@ -0,0 +1,216 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file core_reduction.h
+///
+/// This file contains the reduction of a finite poset to its core by
+/// removing beat points, which keeps the homotopy type of the order
+/// complex, and the further removal of weak points, which keeps its
+/// homology. The points are the identifiers of the Hasse diagram.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef CORE_REDUCTION_H
+#define CORE_REDUCTION_H
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include "order_index.h"
+#include "chain_table.h"
+#include "chain_count.h"
+
+/* the number of the points of X \cap Y \ {v} which are maximal (upward false: minimal) in it, up to 2 */
+inline int coversIn(const orderIndex& order,const std::vector<std::uint64_t>& alive,int v,bool upward){
+  int w = order.words();
+  const std::uint64_t* side = upward ? order.upSet(v) : order.downSet(v);
+  std::vector<std::uint64_t> set(w);
+  for (int k = 0; k < w; ++k)
+    {
+      set[k] = side[k] & alive[k];
+    }
+  set[v >> 6] &= ~((std::uint64_t) 1 << (v & 63));
+  int covers = 0;
+  for (int k = 0; k < w; ++k)
+    {
+      for (std::uint64_t word = set[k]; word != 0; word &= word - 1)
+        {
+          int u = k * 64 + __builtin_ctzll(word);
+          /* u is a cover of v if nothing in the set lies between them */
+          const std::uint64_t* beyond = upward ? order.downSet(u) : order.upSet(u);
+          bool cover = true;
+          for (int l = 0; l < w && cover; ++l)
+            {
+              cover = !(beyond[l] & set[l]);
+            }
+          if (cover && ++covers > 1)
+            {
+              return covers;
+            }
+        }
+    }
+  return covers;
+}
+
+/* a point with exactly one lower cover or exactly one upper cover among the living points */
+inline bool isBeatPoint(const orderIndex& order,const std::vector<std::uint64_t>& alive,int v){
+  return coversIn(order,alive,v,false) == 1 || coversIn(order,alive,v,true) == 1;
+}
+
+/* removes beat points from the living points while there are some */
+inline void removeBeatPoints(const orderIndex& order,std::vector<std::uint64_t>& alive){
+  int n = order.diagram().size();
+  bool changed = true;
+  while (changed)
+    {
+      changed = false;
+      for (int v = 0; v < n; ++v)
+        {
+          if ((alive[v >> 6] >> (v & 63) & 1) && isBeatPoint(order,alive,v))
+            {
+              alive[v >> 6] &= ~((std::uint64_t) 1 << (v & 63));
+              changed = true;
+            }
+        }
+    }
+}
+
+/* the points of the set reduce to a single one by removing beat points */
+inline bool isDismantlable(const orderIndex& order,std::vector<std::uint64_t> set){
+  removeBeatPoints(order,set);
+  int points = 0;
+  for (auto word:set)
+    {
+      points += __builtin_popcountll(word);
+    }
+  return points == 1;
+}
+
+/* a point whose living lower or upper set is dismantlable, hence contractible */
+inline bool isWeakPoint(const orderIndex& order,const std::vector<std::uint64_t>& alive,int v){
+  for (int side = 0; side < 2; ++side)
+    {
+      const std::uint64_t* bits = side ? order.upSet(v) : order.downSet(v);
+      std::vector<std::uint64_t> set(order.words());
+      for (int k = 0; k < order.words(); ++k)
+        {
+          set[k] = bits[k] & alive[k];
+        }
+      set[v >> 6] &= ~((std::uint64_t) 1 << (v & 63));
+      if (isDismantlable(order,set))
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+/*
+  the living points after the reduction: the core (no beat points),
+  and with weak true also without weak points. nothing is removed
+  if the arrows have a cycle.
+*/
+inline std::vector<std::uint64_t> corePoints(const orderIndex& order,bool weak = false){
+  int n = order.diagram().size();
+  std::vector<std::uint64_t> alive(order.words(),0);
+  for (int v = 0; v < n; ++v)
+    {
+      alive[v >> 6] |= (std::uint64_t) 1 << (v & 63);
+    }
+  if (!isAcyclic(order))
+    {
+      return alive;
+    }
+  removeBeatPoints(order,alive);
+  bool changed = weak;
+  while (changed)
+    {
+      changed = false;
+      for (int v = 0; v < n; ++v)
+        {
+          if ((alive[v >> 6] >> (v & 63) & 1) && isWeakPoint(order,alive,v))
+            {
+              alive[v >> 6] &= ~((std::uint64_t) 1 << (v & 63));
+              changed = true;
+            }
+        }
+    }
+  return alive;
+}
+
+/*
+  the maximal chains of the subposet on the living points, in the labels
+  of the diagram. the arrows of the subposet are its covers; a living point
+  which is comparable to no other living point is a chain by itself.
+*/
+inline chainTable inducedMaximalChains(const HasseDiagram& hasse,const orderIndex& order,const std::vector<std::uint64_t>& alive){
+  int n = hasse.size();
+  std::vector<std::array<int,2>> arrows;
+  std::vector<char> comparable(n,0);
+  for (int v = 0; v < n; ++v)
+    {
+      if (!(alive[v >> 6] >> (v & 63) & 1))
+        {
+          continue;
+        }
+      for (int u = 0; u < n; ++u)
+        {
+          if (!(alive[u >> 6] >> (u & 63) & 1) || !order.isBelow(u,v))
+            {
+              continue;
+            }
+          bool cover = true;
+          for (int k = 0; k < order.words() && cover; ++k)
+            {
+              cover = !(order.upSet(u)[k] & order.downSet(v)[k] & alive[k]);
+            }
+          if (cover)
+            {
+              arrows.push_back({{hasse.label(u),hasse.label(v)}});
+              comparable[u] = comparable[v] = 1;
+            }
+        }
+    }
+  chainTable resultList(HasseDiagram(arrows,arrows.size()));
+  for (int v = 0; v < n; ++v)
+    {
+      if ((alive[v >> 6] >> (v & 63) & 1) && !comparable[v])
+        {
+          int label = hasse.label(v);
+          resultList.push(&label,&label + 1);
+        }
+    }
+  return resultList;
+}
+
+/* the maximal chains of the reduced poset, in the labels of the diagram */
+inline chainTable coreMaximalChains(const HasseDiagram& hasse,bool weak,int& corePointNum){
+  orderIndex order(hasse);
+  std::vector<std::uint64_t> alive = corePoints(order,weak);
+  corePointNum = 0;
+  for (auto word:alive)
+    {
+      corePointNum += __builtin_popcountll(word);
+    }
+  return inducedMaximalChains(hasse,order,alive);
+}
+
+#endif
@@ -0,0 +1,216 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file cw_complex.h
+///
+/// This file contains the cellular homology of a CW poset, the face poset
+/// of a regular CW complex: the points are the cells, the rank of a point
+/// is the dimension of its cell and the boundary of a cell over Z_2 is
+/// the sum of the cells it covers. The order complex, which is the
+/// barycentric subdivision of the CW complex, is not built.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef CW_COMPLEX_H
+#define CW_COMPLEX_H
+
+#include <vector>
+#include <algorithm>
+#include <map>
+#include "Z2matrix.h"
+#include "chain_count.h"
+
+/* the points covered by v (identifiers), found among the arrows going down from v */
+inline std::vector<int> lowerCovers(const orderIndex& order,int v){
+  const HasseDiagram& hasse = order.diagram();
+  std::vector<int> covers;
+  for (const int* u = hasse.downBegin(v); u != hasse.downEnd(v); ++u)
+    {
+      if (*u == v || std::find(covers.begin(),covers.end(),*u) != covers.end())
+        {
+          continue;
+        }
+      /* nothing lies between u and v */
+      bool cover = true;
+      for (int k = 0; k < order.words() && cover; ++k)
+        {
+          cover = !(order.upSet(*u)[k] & order.downSet(v)[k]);
+        }
+      if (cover)
+        {
+          covers.push_back(*u);
+        }
+    }
+  return covers;
+}
+
+/*
+  the betti numbers over Z_2 of the cellular chain complex of the cells
+  (a set closed under going down), the boundary of a cell being the sum of
+  its lower covers.
+*/
+inline std::vector<std::uint64_t> cellularBettiNumbers(const HasseDiagram& hasse,const std::vector<int>& rank,const std::vector<std::vector<int>>& covers,std::vector<int> cells){
+  int n = cells.size();
+  /* the cells in the order of dimension, as the simpleces are */
+  std::stable_sort(cells.begin(),cells.end(),[&](int a,int b){ return rank[a] < rank[b]; });
+  std::map<int,int> column;
+  /* bettiNumbers reads only the dimension of each cell: a list of rank+1 entries */
+  std::vector<std::vector<int>> dims(n);
+  for (int j = 0; j < n; ++j)
+    {
+      column[cells[j]] = j + 1;
+      dims[j].assign(rank[cells[j]] + 1,hasse.label(cells[j]));
+    }
+  Z2matrix boundary = Z2matrix();
+  boundary.define(n + 1,n + 1);
+  for (int j = 0; j < n; ++j)
+    {
+      int v = cells[j];
+      if (rank[v] == 0)
+        {
+          boundary.add(0,j + 1,(Z2integer) 1);
+        }
+      for (auto u:covers[v])
+        {
+          boundary.add(column.at(u),j + 1,(Z2integer) 1);
+        }
+    }
+  Z2matrix v = Z2matrix();
+  v.identity(boundary.getncols());
+  boundary.reduceBoundary(boundary,v);
+  return bettiNumbers(boundary,dims);
+}
+
+/*
+  true if the cells below v have the homology over Z_2 of the sphere
+  S^{r-1}, as the boundary of a cell of dimension r >= 2 must have. the
+  cells below are checked first, so their cellular homology is theirs.
+*/
+inline bool isSphereBelow(const orderIndex& order,const std::vector<int>& rank,const std::vector<std::vector<int>>& covers,int v,int r){
+  std::vector<int> cells;
+  const std::uint64_t* below = order.downSet(v);
+  for (int k = 0; k < order.words(); ++k)
+    {
+      for (std::uint64_t word = below[k]; word != 0; word &= word - 1)
+        {
+          cells.push_back(k * 64 + __builtin_ctzll(word));
+        }
+    }
+  std::vector<std::uint64_t> betti = cellularBettiNumbers(order.diagram(),rank,covers,cells);
+  if (betti.size() != r)
+    {
+      return false;
+    }
+  for (int k = 0; k < r; ++k)
+    {
+      if (betti[k] != ((k == 0 || k == r - 1) ? 1 : 0))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+/*
+  the ranks and the lower covers of the points. return false unless the
+  poset is the face poset of a regular CW complex up to homology over Z_2:
+  it is graded, a cell of dimension 1 has two vertices, every interval of
+  length 2 has exactly two points inside (so the boundary of a boundary is
+  0), and the points below a cell of dimension r have the homology of
+  S^{r-1}. the cheap tests come first.
+*/
+inline bool cwCells(const orderIndex& order,std::vector<int>& rank,std::vector<std::vector<int>>& covers){
+  int n = order.diagram().size();
+  if (!isAcyclic(order))
+    {
+      return false;
+    }
+  rank.assign(n,0);
+  covers.assign(n,std::vector<int>());
+  for (auto v:ascendingOrder(order))
+    {
+      covers[v] = lowerCovers(order,v);
+      for (auto u:covers[v])
+        {
+          rank[v] = std::max(rank[v],rank[u] + 1);
+        }
+    }
+  for (int v = 0; v < n; ++v)
+    {
+      for (auto u:covers[v])
+        {
+          if (rank[u] + 1 != rank[v])
+            {
+              return false;
+            }
+        }
+      if (rank[v] == 1 && covers[v].size() != 2)
+        {
+          return false;
+        }
+      /* the points two steps below v, each reached exactly twice */
+      std::vector<int> twoBelow;
+      for (auto u:covers[v])
+        {
+          twoBelow.insert(twoBelow.end(),covers[u].begin(),covers[u].end());
+        }
+      std::sort(twoBelow.begin(),twoBelow.end());
+      for (int i = 0; i < twoBelow.size(); i += 2)
+        {
+          if (i + 1 >= twoBelow.size() || twoBelow[i] != twoBelow[i+1]
+              || (i + 2 < twoBelow.size() && twoBelow[i+2] == twoBelow[i]))
+            {
+              return false;
+            }
+        }
+    }
+  for (auto v:ascendingOrder(order))
+    {
+      if (rank[v] >= 2 && !isSphereBelow(order,rank,covers,v,rank[v]))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+/*
+  the homology of a CW poset over Z_2 from its cellular chain complex,
+  shown as by showHomology. return false if the poset is not a CW poset.
+*/
+inline bool showCellularHomology(const HasseDiagram& hasse){
+  orderIndex order(hasse);
+  std::vector<int> rank;
+  std::vector<std::vector<int>> covers;
+  if (!cwCells(order,rank,covers))
+    {
+      return false;
+    }
+  std::vector<int> cells(hasse.size());
+  for (int v = 0; v < hasse.size(); ++v)
+    {
+      cells[v] = v;
+    }
+  showBettiNumbers(cellularBettiNumbers(hasse,rank,covers,cells),2);
+  return true;
+}
+
+#endif
@@ -0,0 +1,388 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file fixed_simplex.h
+///
+/// This file contains simplex types of a fixed dimension and the kernels
+/// of face enumeration and boundary assembly for them. The loops over
+/// the vertrices of a simplex are unrolled at compile time.
+/// They are used for complexes of dimension at most FIXEDDIM which have
+/// too many vertrices for the bitmask version.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef FIXED_SIMPLEX_H
+#define FIXED_SIMPLEX_H
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include "chain_table.h"
+
+/// The largest dimension of a complex which is handled by the
+/// specialized kernels. Larger complexes use the generic version.
+#ifndef FIXEDDIM
+#define FIXEDDIM 8
+#endif
+
+/// A simplex with D+1 vertrices.
+template <int D>
+using fixedSimplex = std::array<std::uint32_t,D+1>;
+
+// --------------------------------------------------
+// ------------------ unrolled loops ----------------
+// --------------------------------------------------
+
+/// Calls f(0), f(1), ..., f(N-1); the loop is unrolled at compile time.
+template <int N>
+struct unroll
+{
+	template <class function>
+	static void apply (function &f)
+	{
+		unroll<N - 1>::apply (f);
+		f (N - 1);
+		return;
+	}
+}; /* struct unroll */
+
+template <>
+struct unroll<0>
+{
+	template <class function>
+	static void apply (function &)
+	{
+		return;
+	}
+}; /* struct unroll */
+
+// --------------------------------------------------
+// --------------- simplex primitives ---------------
+// --------------------------------------------------
+
+/* the face of a simplex made by deleting the vertex at the position skip */
+template <int D>
+inline fixedSimplex<D-1> fixedFace(const fixedSimplex<D>& simplex,int skip){
+  fixedSimplex<D-1> face;
+  auto copy = [&](int i){
+    if (i < skip)
+      {
+        face[i] = simplex[i];
+      } else if (i > skip)
+      {
+        face[i-1] = simplex[i];
+      }
+  };
+  unroll<D+1>::apply(copy);
+  return face;
+}
+
+/* all codimension one faces, in the same order as boundary() */
+template <int D>
+inline std::array<fixedSimplex<D-1>,D+1> fixedBoundary(const fixedSimplex<D>& simplex){
+  std::array<fixedSimplex<D-1>,D+1> boundaryList;
+  auto make = [&](int i){
+    boundaryList[i] = fixedFace<D>(simplex,i);
+  };
+  unroll<D+1>::apply(make);
+  return boundaryList;
+}
+
+/* vertex list of a simplex as a fixed simplex */
+template <int D>
+inline fixedSimplex<D> toFixedSimplex(const std::vector<int>& simplex){
+  fixedSimplex<D> fixed;
+  auto copy = [&](int i){
+    fixed[i] = (std::uint32_t) simplex[i];
+  };
+  unroll<D+1>::apply(copy);
+  return fixed;
+}
+
+// --------------------------------------------------
+// ----------------- face enumeration ----------------
+// --------------------------------------------------
+
+/// The faces with N vertrices and, recursively, all smaller faces.
+/// Each size is deduplicated separately by sorting.
+template <int N>
+struct fixedFaceBuckets
+{
+	/// The faces with exactly N vertrices.
+	std::vector<std::array<std::uint32_t,N>> faces;
+
+	/// The smaller faces.
+	fixedFaceBuckets<N - 1> smaller;
+
+	/// Adds a face with the given number of vertrices.
+	void push (int size, const std::uint32_t *vertex)
+	{
+		if (size != N)
+		{
+			smaller. push (size, vertex);
+			return;
+		}
+		std::array<std::uint32_t,N> face;
+		std::copy (vertex, vertex + N, face. begin ());
+		faces. push_back (face);
+		return;
+	}
+
+	/// Appends all the distinct faces, smaller ones first.
+	void emit (std::vector<std::vector<int>> &faceList)
+	{
+		smaller. emit (faceList);
+		std::sort (faces. begin (), faces. end ());
+		faces. erase (std::unique (faces. begin (), faces. end ()),
+			faces. end ());
+		for (const auto &face: faces)
+			faceList. push_back (std::vector<int> (face. begin (),
+				face. end ()));
+		return;
+	}
+}; /* struct fixedFaceBuckets */
+
+template <>
+struct fixedFaceBuckets<0>
+{
+	void push (int, const std::uint32_t *)
+	{
+		return;
+	}
+
+	void emit (std::vector<std::vector<int>> &)
+	{
+		return;
+	}
+}; /* struct fixedFaceBuckets */
+
+/// Face enumeration of chains (or simpleces) with at most N vertrices,
+/// read from a list of vectors or a chainTable. The faces are listed by
+/// the size and then lexicographically, as sorted by simplexOrder.
+template <class chainList>
+struct fixedFaceKernel
+{
+	const chainList &maximalChains;
+	std::vector<std::vector<int>> &faceList;
+
+	template <int N>
+	void apply ()
+	{
+		fixedFaceBuckets<N> buckets;
+		std::uint32_t face [N];
+		for (int j = 0; j < chainCount (maximalChains); ++ j)
+		{
+			const int *maximalChain = chainBegin (maximalChains, j);
+			int size = chainEnd (maximalChains, j) - maximalChain;
+			for (unsigned mask = 1; mask < (1u << size); ++ mask)
+			{
+				int k = 0;
+				for (int i = 0; i < size; ++ i)
+				{
+					if (mask >> i & 1)
+						face [k ++] = maximalChain [i];
+				}
+				buckets. push (k, face);
+			}
+		}
+		buckets. emit (faceList);
+		return;
+	}
+}; /* struct fixedFaceKernel */
+
+// --------------------------------------------------
+// ----------------- boundary kernel ----------------
+// --------------------------------------------------
+
+/// The simpleces with N vertrices (as sorted vertex lists together with
+/// their indices) and, recursively, all smaller simpleces.
+template <int N>
+struct fixedSimplexBuckets
+{
+	/// The simpleces with exactly N vertrices sorted by the vertrices.
+	std::vector<std::pair<fixedSimplex<N - 1>,int>> simpleces;
+
+	/// The smaller simpleces.
+	fixedSimplexBuckets<N - 1> smaller;
+
+	/// Adds a simplex with the given index.
+	void add (const std::vector<int> &simplex, int id)
+	{
+		if (static_cast<int> (simplex. size ()) != N)
+		{
+			smaller. add (simplex, id);
+			return;
+		}
+		fixedSimplex<N - 1> fixed = toFixedSimplex<N - 1> (simplex);
+		std::sort (fixed. begin (), fixed. end ());
+		simpleces. push_back (std::make_pair (fixed, id));
+		return;
+	}
+
+	/// Sorts the simpleces of every size.
+	void sort ()
+	{
+		smaller. sort ();
+		std::sort (simpleces. begin (), simpleces. end ());
+		return;
+	}
+
+	/// Returns the index of the given simplex or -1 if not found.
+	int find (const fixedSimplex<N - 1> &simplex) const
+	{
+		auto it = std::lower_bound (simpleces. begin (), simpleces. end (),
+			std::make_pair (simplex, -1));
+		if ((it == simpleces. end ()) || (it -> first != simplex))
+			return -1;
+		return it -> second;
+	}
+
+	/// Calls f(i,j,k) for every codimension one face i of every simplex j,
+	/// where the face is made by deleting the k-th smallest vertex.
+	template <class function>
+	void faces (function &f) const
+	{
+		smaller. faces (f);
+		for (const auto &s: simpleces)
+		{
+			std::array<fixedSimplex<N - 2>,N> boundaryList =
+				fixedBoundary<N - 1> (s. first);
+			for (int k = 0; k < N; ++ k)
+			{
+				int i = smaller. find (boundaryList [k]);
+				if (i != -1)
+					f (i, s. second, k);
+			}
+		}
+		return;
+	}
+}; /* struct fixedSimplexBuckets */
+
+template <>
+struct fixedSimplexBuckets<1>
+{
+	std::vector<std::pair<fixedSimplex<0>,int>> simpleces;
+
+	void add (const std::vector<int> &simplex, int id)
+	{
+		if (simplex. size () == 1)
+			simpleces. push_back (std::make_pair
+				(toFixedSimplex<0> (simplex), id));
+		return;
+	}
+
+	void sort ()
+	{
+		std::sort (simpleces. begin (), simpleces. end ());
+		return;
+	}
+
+	int find (const fixedSimplex<0> &simplex) const
+	{
+		auto it = std::lower_bound (simpleces. begin (), simpleces. end (),
+			std::make_pair (simplex, -1));
+		if ((it == simpleces. end ()) || (it -> first != simplex))
+			return -1;
+		return it -> second;
+	}
+
+	/// A vertex has no codimension one face in the complex.
+	template <class function>
+	void faces (function &) const
+	{
+		return;
+	}
+}; /* struct fixedSimplexBuckets */
+
+/// Boundary assembly for simpleces with at most N vertrices.
+template <class function>
+struct fixedBoundaryKernel
+{
+	const std::vector<std::vector<int>> &simpleces;
+	function &f;
+
+	template <int N>
+	void apply ()
+	{
+		fixedSimplexBuckets<N> buckets;
+		for (int i = 0; i < static_cast<int> (simpleces. size ()); ++ i)
+			buckets. add (simpleces [i], i);
+		buckets. sort ();
+		buckets. faces (f);
+		return;
+	}
+}; /* struct fixedBoundaryKernel */
+
+// --------------------------------------------------
+// -------------------- dispatch --------------------
+// --------------------------------------------------
+
+/// Runs kernel.apply<top>() if 1 <= top <= N; returns false otherwise.
+template <int N>
+struct fixedDispatch
+{
+	template <class kernel>
+	static bool run (int top, kernel &k)
+	{
+		if (top == N)
+		{
+			k. template apply<N> ();
+			return true;
+		}
+		return fixedDispatch<N - 1>::run (top, k);
+	}
+}; /* struct fixedDispatch */
+
+template <>
+struct fixedDispatch<0>
+{
+	template <class kernel>
+	static bool run (int, kernel &)
+	{
+		return false;
+	}
+}; /* struct fixedDispatch */
+
+/*
+  every nonempty face of each chain, sorted as simplexOrder.
+  top is the largest number of vertrices of a chain (see dimention()).
+  return false if top is too large for the specialized kernels.
+*/
+template <class chainList>
+inline bool enumerateFacesByFixedSimplex(const chainList& maximalChains,int top,std::vector<std::vector<int>>& faceList){
+  fixedFaceKernel<chainList> kernel = {maximalChains,faceList};
+  return fixedDispatch<FIXEDDIM+1>::run(top,kernel);
+}
+
+/*
+  calls f(i,j,k) for every codimension one face i of the j-th simplex,
+  where the face is made by deleting the k-th smallest vertex.
+  return false if top is too large for the specialized kernels.
+*/
+template <class function>
+bool forEachFaceByFixedSimplex(const std::vector<std::vector<int>>& simpleces,int top,function f){
+  fixedBoundaryKernel<function> kernel = {simpleces,f};
+  return fixedDispatch<FIXEDDIM+1>::run(top,kernel);
+}
+
+#endif
@@ -0,0 +1,288 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file hasse_diagram.h
+///
+/// This file contains the class HasseDiagram, the covering relation of
+/// a poset stored as a compressed sparse row graph. It is built once
+/// from the list of arrows and used by all the poset algorithms.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef HASSE_DIAGRAM_H
+#define HASSE_DIAGRAM_H
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include "vertex_labels.h"
+
+class HasseDiagram;
+
+// --------------------------------------------------
+// ------------------ HasseDiagram ------------------
+// --------------------------------------------------
+
+/// The Hasse diagram of a poset given by its arrows {A,B} (A < B).
+/// The points get the dense identifiers 0, ..., n-1 in the ascending
+/// order of their labels. The arrows going up and down from each point
+/// are kept in two CSR tables in the order in which they were given,
+/// so every query costs O(degree).
+class HasseDiagram
+{
+public:
+	/// The default constructor of an empty diagram.
+	HasseDiagram ();
+
+	/// Builds the diagram of the first 'numberOfArrows' arrows.
+	HasseDiagram (const std::vector<std::array<int,2>> &arrowList,
+		int numberOfArrows);
+
+	/// Returns the number of points.
+	int size () const;
+
+	/// Returns the identifier of the label or -1 if not a point.
+	int id (int label) const;
+
+	/// Returns the label of the identifier.
+	int label (int id) const;
+
+	/// The points covering the given one: [upBegin, upEnd).
+	const int *upBegin (int id) const;
+	const int *upEnd (int id) const;
+
+	/// The points covered by the given one: [downBegin, downEnd).
+	const int *downBegin (int id) const;
+	const int *downEnd (int id) const;
+
+	/// Returns true if the point is maximal, as in maximals().
+	bool isMaximal (int id) const;
+
+	/// Returns true if the point is minimal, as in minimals().
+	bool isMinimal (int id) const;
+
+	/// The maximal points in the order of maximals().
+	const std::vector<int> &maximalList () const;
+
+	/// The minimal points in the order of minimals().
+	const std::vector<int> &minimalList () const;
+
+	/// Appends the identifiers of the points bigger than the given one.
+	void bigger (int id, std::vector<int> &result) const;
+
+	/// Appends the identifiers of the points smaller than the given one.
+	void smaller (int id, std::vector<int> &result) const;
+
+private:
+	/// The labels of the points and their identifiers.
+	vertexLabels labels;
+
+	/// The CSR table of the arrows going up.
+	std::vector<int> upOffset, upTarget;
+
+	/// The CSR table of the arrows going down.
+	std::vector<int> downOffset, downTarget;
+
+	/// The flags of the maximal and minimal points.
+	std::vector<char> maximal, minimal;
+
+	/// The maximal and minimal points in the order of the arrows.
+	std::vector<int> maximals, minimals;
+
+	/// Collects the points reachable from 'id' in the given table,
+	/// not going through the points marked in 'stop'.
+	void reach (int id, const std::vector<int> &offset,
+		const std::vector<int> &target, const std::vector<char> &stop,
+		std::vector<int> &result) const;
+
+}; /* class HasseDiagram */
+
+// --------------------------------------------------
+
+inline HasseDiagram::HasseDiagram ():
+	upOffset (1, 0), downOffset (1, 0)
+{
+	return;
+} /* HasseDiagram::HasseDiagram */
+
+inline HasseDiagram::HasseDiagram
+	(const std::vector<std::array<int,2>> &arrowList, int numberOfArrows)
+{
+	std::vector<int> points;
+	for (int i = 0; i < numberOfArrows; ++ i)
+	{
+		points. push_back (arrowList [i] [0]);
+		points. push_back (arrowList [i] [1]);
+	}
+	labels = vertexLabels (points);
+	int n = labels. size ();
+
+	// count the arrows at each point and make the offsets
+	std::vector<int> source (numberOfArrows), target (numberOfArrows);
+	upOffset. assign (n + 1, 0);
+	downOffset. assign (n + 1, 0);
+	for (int i = 0; i < numberOfArrows; ++ i)
+	{
+		source [i] = id (arrowList [i] [0]);
+		target [i] = id (arrowList [i] [1]);
+		++ upOffset [source [i] + 1];
+		++ downOffset [target [i] + 1];
+	}
+	for (int v = 0; v < n; ++ v)
+	{
+		upOffset [v + 1] += upOffset [v];
+		downOffset [v + 1] += downOffset [v];
+	}
+
+	// fill in the tables keeping the order of the arrows
+	upTarget. resize (numberOfArrows);
+	downTarget. resize (numberOfArrows);
+	std::vector<int> upFill (upOffset. begin (), upOffset. end () - 1);
+	std::vector<int> downFill (downOffset. begin (),
+		downOffset. end () - 1);
+	for (int i = 0; i < numberOfArrows; ++ i)
+	{
+		upTarget [upFill [source [i]] ++] = target [i];
+		downTarget [downFill [target [i]] ++] = source [i];
+	}
+
+	// a point is maximal if it is the end of an arrow and no other arrow
+	// starts at it; the minimal points are defined in the same way
+	maximal. assign (n, 0);
+	minimal. assign (n, 0);
+	for (int i = 0; i < numberOfArrows; ++ i)
+	{
+		int t = target [i];
+		int out = upOffset [t + 1] - upOffset [t] - (source [i] == t);
+		if (!out && !maximal [t])
+		{
+			maximal [t] = 1;
+			maximals. push_back (t);
+		}
+	}
+	for (int i = 0; i < numberOfArrows; ++ i)
+	{
+		int s = source [i];
+		int in = downOffset [s + 1] - downOffset [s] - (target [i] == s);
+		if (!in && !minimal [s])
+		{
+			minimal [s] = 1;
+			minimals. push_back (s);
+		}
+	}
+	return;
+} /* HasseDiagram::HasseDiagram */
+
+inline int HasseDiagram::size () const
+{
+	return labels. size ();
+} /* HasseDiagram::size */
+
+inline int HasseDiagram::id (int l) const
+{
+	// the identity table of an empty diagram knows no point
+	int v = labels. id (l);
+	return ((v >= 0) && (v < size ())) ? v : -1;
+} /* HasseDiagram::id */
+
+inline int HasseDiagram::label (int v) const
+{
+	return labels. label (v);
+} /* HasseDiagram::label */
+
+inline const int *HasseDiagram::upBegin (int v) const
+{
+	return upTarget. data () + upOffset [v];
+} /* HasseDiagram::upBegin */
+
+inline const int *HasseDiagram::upEnd (int v) const
+{
+	return upTarget. data () + upOffset [v + 1];
+} /* HasseDiagram::upEnd */
+
+inline const int *HasseDiagram::downBegin (int v) const
+{
+	return downTarget. data () + downOffset [v];
+} /* HasseDiagram::downBegin */
+
+inline const int *HasseDiagram::downEnd (int v) const
+{
+	return downTarget. data () + downOffset [v + 1];
+} /* HasseDiagram::downEnd */
+
+inline bool HasseDiagram::isMaximal (int v) const
+{
+	return maximal [v];
+} /* HasseDiagram::isMaximal */
+
+inline bool HasseDiagram::isMinimal (int v) const
+{
+	return minimal [v];
+} /* HasseDiagram::isMinimal */
+
+inline const std::vector<int> &HasseDiagram::maximalList () const
+{
+	return maximals;
+} /* HasseDiagram::maximalList */
+
+inline const std::vector<int> &HasseDiagram::minimalList () const
+{
+	return minimals;
+} /* HasseDiagram::minimalList */
+
+inline void HasseDiagram::reach (int v, const std::vector<int> &offset,
+	const std::vector<int> &target, const std::vector<char> &stop,
+	std::vector<int> &result) const
+{
+	std::vector<char> seen (size (), 0);
+	std::vector<int> stack (1, v);
+	while (!stack. empty ())
+	{
+		int u = stack. back ();
+		stack. pop_back ();
+		if (stop [u])
+			continue;
+		for (int k = offset [u]; k < offset [u + 1]; ++ k)
+		{
+			int w = target [k];
+			if (seen [w])
+				continue;
+			seen [w] = 1;
+			result. push_back (w);
+			stack. push_back (w);
+		}
+	}
+	return;
+} /* HasseDiagram::reach */
+
+inline void HasseDiagram::bigger (int v, std::vector<int> &result) const
+{
+	reach (v, upOffset, upTarget, maximal, result);
+	return;
+} /* HasseDiagram::bigger */
+
+inline void HasseDiagram::smaller (int v, std::vector<int> &result) const
+{
+	reach (v, downOffset, downTarget, minimal, result);
+	return;
+} /* HasseDiagram::smaller */
+
+#endif
@@ -0,0 +1,780 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file mayer_vietoris.h
+///
+/// This file contains the homology over Z_2 of the order complex of a poset
+/// computed by divide and conquer: the poset is covered by two down-closed
+/// (or up-closed) pieces with balanced numbers of maximal chains, the
+/// pieces and their intersection are computed on their own, and the
+/// results are glued by the Mayer-Vietoris sequence.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef MAYER_VIETORIS_H
+#define MAYER_VIETORIS_H
+
+#include <vector>
+#include <set>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
+#include "simplex_tree.h"
+#include "core_reduction.h"
+#include "Z2matrix.h"
+
+/// A chain over Z_2 as the set of its simpleces, each sorted.
+typedef std::set<std::vector<int>> simplexSet;
+
+class mayerVietoris;
+
+// --------------------------------------------------
+// ------------------ mayerVietoris -----------------
+// --------------------------------------------------
+
+/// The homology over Z_2 of the order complex of a convex subposet (given
+/// by the bitset of its points), with a basis of cycles in every dimension.
+/// A subposet with a single maximal or minimal point is a cone. A subposet
+/// with few maximal chains is reduced as a matrix by makeBoundaryMatrix and
+/// reduceBoundary. A bigger one is covered by the down-closures of two sets
+/// of its maximal points (or the up-closures of two sets of its minimal
+/// points), whose order complexes meet in that of their intersection, and
+/// its homology is glued from the three pieces by the Mayer-Vietoris
+/// sequence H(C) -> H(A) + H(B) -> H(A u B) -> H(C).
+class mayerVietoris
+{
+public:
+	/// Computes the homology of the subposet on the living points, which
+	/// must be convex. The pieces reduced as matrices have at most 'limit'
+	/// maximal chains. The pieces of the first levels are computed
+	/// in threads of their own.
+	mayerVietoris (const HasseDiagram &_hasse, const orderIndex &_order,
+		const std::vector<std::uint64_t> &_alive, std::uint64_t limit,
+		int depth = 0);
+
+	/// Returns the number of dimensions with simpleces.
+	int levels () const;
+
+	/// Returns the basis of cycles of H_k.
+	const std::vector<simplexSet> &basis (int k) const;
+
+	/// Finds the coordinates of the homology class of a k-cycle in the
+	/// basis. If 'preimage' is given, the cycle must be a boundary and a
+	/// (k+1)-chain whose boundary is the cycle is put there.
+	void decompose (const simplexSet &cycle, int k,
+		std::vector<char> &coordinates, simplexSet *preimage) const;
+
+	/// Counts the pieces reduced as matrices, the cones and the largest
+	/// number of maximal chains in a matrix.
+	void countPieces (int &matrices, int &cones,
+		std::uint64_t &largest) const;
+
+private:
+	/// The diagram and its order.
+	const HasseDiagram &hasse;
+	const orderIndex &order;
+
+	/// The points of the subposet.
+	std::vector<std::uint64_t> alive;
+
+	/// The number of maximal chains of the subposet.
+	std::uint64_t chains;
+
+	/// The number of points of its longest chain.
+	int height;
+
+	/// The apex of a cone or -1.
+	int apex;
+
+	/// The simpleces of a piece reduced as a matrix (empty otherwise).
+	std::vector<std::vector<int>> simpleces;
+
+	/// The index of the simpleces.
+	simplexTree index;
+
+	/// The reduced boundary matrix and the change of basis.
+	Z2matrix reduced;
+	Z2matrix v;
+
+	/// The column whose lowest entry is in each row or -1.
+	std::vector<int> pivot;
+
+	/// The number of the generator of each column in its basis or -1.
+	std::vector<int> generator;
+
+	/// The two pieces and their intersection of a piece which is split.
+	std::unique_ptr<mayerVietoris> a, b, c;
+
+	/// The map H_k(C) -> H_k(A) + H_k(B) reduced by columns.
+	struct gluing
+	{
+		/// The reduced columns, the combinations of the basis of
+		/// H_k(C) they come from, and the column of each lowest row.
+		std::vector<std::vector<char>> columns;
+		std::vector<std::vector<char>> combinations;
+		std::vector<int> pivots;
+
+		/// The number in the basis of H_k(A u B) of every row which is
+		/// no lowest row, or -1.
+		std::vector<int> complement;
+
+		/// The kernel, reduced to distinct lowest rows.
+		std::vector<std::vector<char>> kernel;
+		std::vector<int> kernelPivots;
+	};
+
+	/// The map in every dimension.
+	std::vector<gluing> maps;
+
+	/// The bases of cycles: for a split piece, the images of H_k(A) +
+	/// H_k(B) come first and the cycles of the kernel of the map of
+	/// dimension k-1 last.
+	std::vector<std::vector<simplexSet>> bases;
+
+	/// Returns true if all the points of the simplex are in the subposet.
+	bool contains (const std::vector<int> &simplex) const;
+
+	/// Reduces the piece as a matrix.
+	void reduce ();
+
+	/// Splits the piece and glues the homology of the three pieces.
+	void split (std::uint64_t limit, int depth);
+
+	/// Decomposes a cycle in the three kinds of pieces.
+	void decomposeMatrix (const simplexSet &cycle, int k,
+		std::vector<char> &coordinates, simplexSet *preimage) const;
+	void decomposeCone (const simplexSet &cycle, int k,
+		std::vector<char> &coordinates, simplexSet *preimage) const;
+	void decomposeSplit (simplexSet cycle, int k,
+		std::vector<char> &coordinates, simplexSet *preimage) const;
+
+}; /* class mayerVietoris */
+
+// --------------------------------------------------
+
+/// Adds a simplex to a chain over Z_2.
+inline void toggleSimplex (simplexSet &chain, const std::vector<int> &simplex)
+{
+	auto found = chain. find (simplex);
+	if (found == chain. end ())
+		chain. insert (simplex);
+	else
+		chain. erase (found);
+	return;
+} /* toggleSimplex */
+
+/// Adds a chain to another one over Z_2.
+inline void addChain (simplexSet &chain, const simplexSet &other)
+{
+	for (const auto &s: other)
+		toggleSimplex (chain, s);
+	return;
+} /* addChain */
+
+/// Returns the boundary of a chain without the augmentation.
+inline simplexSet chainBoundary (const simplexSet &chain)
+{
+	simplexSet result;
+	for (const auto &s: chain)
+	{
+		if (s. size () < 2)
+			continue;
+		for (int k = 0; k < s. size (); ++ k)
+		{
+			std::vector<int> face (s);
+			face. erase (face. begin () + k);
+			toggleSimplex (result, face);
+		}
+	}
+	return result;
+} /* chainBoundary */
+
+/// Returns the highest nonzero entry of a vector over Z_2 or -1.
+inline int highestEntry (const std::vector<char> &vector)
+{
+	for (int i = vector. size () - 1; i >= 0; -- i)
+	{
+		if (vector [i])
+			return i;
+	}
+	return -1;
+} /* highestEntry */
+
+/// Adds a vector to another one over Z_2.
+inline void addVector (std::vector<char> &vector,
+	const std::vector<char> &other)
+{
+	for (int i = 0; i < other. size (); ++ i)
+		vector [i] ^= other [i];
+	return;
+} /* addVector */
+
+// --------------------------------------------------
+
+inline mayerVietoris::mayerVietoris (const HasseDiagram &_hasse,
+	const orderIndex &_order, const std::vector<std::uint64_t> &_alive,
+	std::uint64_t limit, int depth): hasse (_hasse), order (_order),
+	alive (_alive), chains (0), height (0), apex (-1)
+{
+	int n = hasse. size ();
+	auto isAlive = [this] (int u)
+		{ return (alive [u >> 6] >> (u & 63)) & 1; };
+
+	// count the maximal chains ending at every point from the bottom up
+	std::vector<std::uint64_t> below (n, 0);
+	std::vector<int> rank (n, 0);
+	std::vector<int> maximals, minimals;
+	for (auto u: ascendingOrder (order))
+	{
+		if (!isAlive (u))
+			continue;
+		bool minimal = true, maximal = true;
+		for (const int *w = hasse. downBegin (u);
+			w != hasse. downEnd (u); ++ w)
+		{
+			if ((*w != u) && isAlive (*w))
+			{
+				below [u] += below [*w];
+				rank [u] = std::max (rank [u], rank [*w]);
+				minimal = false;
+			}
+		}
+		for (const int *w = hasse. upBegin (u);
+			w != hasse. upEnd (u); ++ w)
+		{
+			if ((*w != u) && isAlive (*w))
+				maximal = false;
+		}
+		height = std::max (height, ++ rank [u]);
+		if (minimal)
+		{
+			below [u] = 1;
+			minimals. push_back (u);
+		}
+		if (maximal)
+		{
+			chains += below [u];
+			maximals. push_back (u);
+		}
+	}
+
+	// an empty piece has no homology
+	if (maximals. empty ())
+		return;
+
+	// a piece with a single maximal or minimal point is a cone
+	if ((maximals. size () == 1) || (minimals. size () == 1))
+	{
+		apex = (maximals. size () == 1) ? maximals [0] : minimals [0];
+		bases. assign (height, std::vector<simplexSet> ());
+		bases [0]. resize (1);
+		bases [0] [0]. insert (std::vector<int> (1, hasse. label (apex)));
+		return;
+	}
+
+	if (chains <= limit)
+		reduce ();
+	else
+		split (limit, depth);
+	return;
+} /* mayerVietoris::mayerVietoris */
+
+inline int mayerVietoris::levels () const
+{
+	return height;
+} /* mayerVietoris::levels */
+
+inline const std::vector<simplexSet> &mayerVietoris::basis (int k) const
+{
+	static const std::vector<simplexSet> none;
+	if ((k < 0) || (k >= bases. size ()))
+		return none;
+	return bases [k];
+} /* mayerVietoris::basis */
+
+inline bool mayerVietoris::contains (const std::vector<int> &simplex) const
+{
+	for (auto label: simplex)
+	{
+		int u = hasse. id (label);
+		if (!((alive [u >> 6] >> (u & 63)) & 1))
+			return false;
+	}
+	return true;
+} /* mayerVietoris::contains */
+
+inline void mayerVietoris::reduce ()
+{
+	simpleces = getChainComplexGenerators
+		(inducedMaximalChains (hasse, order, alive));
+	index = simplexTree (simpleces);
+	reduced = makeBoundaryMatrix (simpleces);
+	v. identity (reduced. getncols ());
+	reduced. reduceBoundary (reduced, v);
+
+	// the augmentation row 0 is left out: this is unreduced homology
+	int size = reduced. getncols ();
+	pivot. assign (size, -1);
+	generator. assign (size, -1);
+	for (int j = 1; j < size; ++ j)
+	{
+		int row = reduced. low (j) - 1;
+		if (row > 0)
+			pivot [row] = j;
+	}
+	bases. assign (height, std::vector<simplexSet> ());
+	for (int j = 1; j < size; ++ j)
+	{
+		if ((reduced. low (j) - 1 > 0) || (pivot [j] != -1))
+			continue;
+		int k = simpleces [j - 1]. size () - 1;
+		generator [j] = bases [k]. size ();
+		simplexSet cycle;
+		const Z2chain &col = v. getcol (j);
+		for (int i = 0; i < col. size (); ++ i)
+		{
+			std::vector<int> s = simpleces [col. num (i) - 1];
+			std::sort (s. begin (), s. end ());
+			toggleSimplex (cycle, s);
+		}
+		bases [k]. push_back (cycle);
+	}
+	return;
+} /* mayerVietoris::reduce */
+
+inline void mayerVietoris::split (std::uint64_t limit, int depth)
+{
+	int n = hasse. size ();
+	int w = order. words ();
+	auto isAlive = [this] (int u)
+		{ return (alive [u >> 6] >> (u & 63)) & 1; };
+
+	// the numbers of the maximal chains through every maximal point
+	// (downward) and through every minimal point (upward)
+	std::vector<std::vector<std::uint64_t>> through (2,
+		std::vector<std::uint64_t> (n, 0));
+	std::vector<int> ascending = ascendingOrder (order);
+	for (int upward = 0; upward < 2; ++ upward)
+	{
+		std::vector<std::uint64_t> &count = through [upward];
+		for (int i = 0; i < n; ++ i)
+		{
+			int u = upward ? ascending [n - 1 - i] : ascending [i];
+			if (!isAlive (u))
+				continue;
+			const int *begin = upward ? hasse. upBegin (u) :
+				hasse. downBegin (u);
+			const int *end = upward ? hasse. upEnd (u) :
+				hasse. downEnd (u);
+			bool extremal = true;
+			for (const int *x = begin; x != end; ++ x)
+			{
+				if ((*x != u) && isAlive (*x))
+				{
+					count [u] += count [*x];
+					extremal = false;
+				}
+			}
+			if (extremal)
+				count [u] = 1;
+		}
+	}
+
+	// deal the extremal points to two sides, the most chains first,
+	// and keep the direction in which the heavier side is lighter
+	std::vector<std::vector<std::uint64_t>> side (2,
+		std::vector<std::uint64_t> (w, 0));
+	std::uint64_t best = 0;
+	for (int upward = 0; upward < 2; ++ upward)
+	{
+		std::vector<int> extremals;
+		for (int u = 0; u < n; ++ u)
+		{
+			if (!isAlive (u))
+				continue;
+			const int *begin = upward ? hasse. downBegin (u) :
+				hasse. upBegin (u);
+			const int *end = upward ? hasse. downEnd (u) :
+				hasse. upEnd (u);
+			bool extremal = true;
+			for (const int *x = begin; (x != end) && extremal; ++ x)
+				extremal = (*x == u) || !isAlive (*x);
+			if (extremal)
+				extremals. push_back (u);
+		}
+		const std::vector<std::uint64_t> &count = through [upward];
+		std::stable_sort (extremals. begin (), extremals. end (),
+			[&count] (int x, int y) { return count [x] > count [y]; });
+		std::vector<std::vector<std::uint64_t>> closure (2,
+			std::vector<std::uint64_t> (w, 0));
+		std::uint64_t weight [2] = {0, 0};
+		for (auto u: extremals)
+		{
+			int s = (weight [1] < weight [0]) ? 1 : 0;
+			weight [s] += count [u];
+			const std::uint64_t *set = upward ? order. upSet (u) :
+				order. downSet (u);
+			for (int k = 0; k < w; ++ k)
+				closure [s] [k] |= set [k] & alive [k];
+			closure [s] [u >> 6] |= (std::uint64_t) 1 << (u & 63);
+		}
+		std::uint64_t heavier = std::max (weight [0], weight [1]);
+		if (!upward || (heavier < best))
+		{
+			best = heavier;
+			side = closure;
+		}
+	}
+	std::vector<std::uint64_t> both (w);
+	for (int k = 0; k < w; ++ k)
+		both [k] = side [0] [k] & side [1] [k];
+
+	// the pieces of the first levels are computed in parallel
+	if (depth < 2)
+	{
+		std::thread first ([&] () { a. reset (new mayerVietoris
+			(hasse, order, side [0], limit, depth + 1)); });
+		std::thread second ([&] () { b. reset (new mayerVietoris
+			(hasse, order, side [1], limit, depth + 1)); });
+		c. reset (new mayerVietoris (hasse, order, both, limit, depth + 1));
+		first. join ();
+		second. join ();
+	}
+	else
+	{
+		a. reset (new mayerVietoris (hasse, order, side [0], limit,
+			depth + 1));
+		b. reset (new mayerVietoris (hasse, order, side [1], limit,
+			depth + 1));
+		c. reset (new mayerVietoris (hasse, order, both, limit,
+			depth + 1));
+	}
+
+	// reduce the map H_k(C) -> H_k(A) + H_k(B) in every dimension
+	maps. assign (height, gluing ());
+	bases. assign (height, std::vector<simplexSet> ());
+	for (int k = 0; k < height; ++ k)
+	{
+		gluing &m = maps [k];
+		int na = a -> basis (k). size ();
+		int rows = na + b -> basis (k). size ();
+		int nc = c -> basis (k). size ();
+		m. pivots. assign (rows, -1);
+		for (int i = 0; i < nc; ++ i)
+		{
+			const simplexSet &cycle = c -> basis (k) [i];
+			std::vector<char> inA, inB;
+			a -> decompose (cycle, k, inA, 0);
+			b -> decompose (cycle, k, inB, 0);
+			std::vector<char> column (inA);
+			column. insert (column. end (), inB. begin (), inB. end ());
+			std::vector<char> combination (nc, 0);
+			combination [i] = 1;
+			int row = highestEntry (column);
+			while ((row != -1) && (m. pivots [row] != -1))
+			{
+				addVector (column, m. columns [m. pivots [row]]);
+				addVector (combination,
+					m. combinations [m. pivots [row]]);
+				row = highestEntry (column);
+			}
+			if (row != -1)
+			{
+				m. pivots [row] = m. columns. size ();
+				m. columns. push_back (column);
+				m. combinations. push_back (combination);
+				continue;
+			}
+
+			// a cycle of the kernel, independent of the others
+			m. kernelPivots. resize (nc, -1);
+			row = highestEntry (combination);
+			while (m. kernelPivots [row] != -1)
+			{
+				addVector (combination,
+					m. kernel [m. kernelPivots [row]]);
+				row = highestEntry (combination);
+			}
+			m. kernelPivots [row] = m. kernel. size ();
+			m. kernel. push_back (combination);
+		}
+
+		// the rows which are no lowest rows give the cokernel
+		m. complement. assign (rows, -1);
+		for (int row = 0; row < rows; ++ row)
+		{
+			if (m. pivots [row] != -1)
+				continue;
+			m. complement [row] = bases [k]. size ();
+			bases [k]. push_back ((row < na) ? a -> basis (k) [row] :
+				b -> basis (k) [row - na]);
+		}
+
+		// the kernel of dimension k-1 gives the cycles a + b where
+		// a and b bound the same cycle of C in A and in B
+		if (k == 0)
+			continue;
+		for (const auto &combination: maps [k - 1]. kernel)
+		{
+			simplexSet cycle, inA, inB;
+			for (int i = 0; i < combination. size (); ++ i)
+			{
+				if (combination [i])
+					addChain (cycle, c -> basis (k - 1) [i]);
+			}
+			std::vector<char> coordinates;
+			a -> decompose (cycle, k - 1, coordinates, &inA);
+			b -> decompose (cycle, k - 1, coordinates, &inB);
+			addChain (inA, inB);
+			bases [k]. push_back (inA);
+		}
+	}
+	return;
+} /* mayerVietoris::split */
+
+inline void mayerVietoris::decompose (const simplexSet &cycle, int k,
+	std::vector<char> &coordinates, simplexSet *preimage) const
+{
+	if (preimage)
+		preimage -> clear ();
+	coordinates. assign (basis (k). size (), 0);
+	if (cycle. empty ())
+		return;
+	if (!simpleces. empty ())
+		decomposeMatrix (cycle, k, coordinates, preimage);
+	else if (apex != -1)
+		decomposeCone (cycle, k, coordinates, preimage);
+	else if (a)
+		decomposeSplit (cycle, k, coordinates, preimage);
+	else
+		throw "A chain of an empty piece in Mayer-Vietoris.";
+	if (preimage && (std::find (coordinates. begin (), coordinates. end (),
+		1) != coordinates. end ()))
+	{
+		throw "Trying to bound a cycle which is not a boundary.";
+	}
+	return;
+} /* mayerVietoris::decompose */
+
+inline void mayerVietoris::decomposeMatrix (const simplexSet &cycle, int k,
+	std::vector<char> &coordinates, simplexSet *preimage) const
+{
+	// cancel the lowest entry by a boundary or a generator
+	Z2chain z, bound;
+	for (const auto &s: cycle)
+	{
+		int i = index. find (s);
+		if (i == -1)
+			throw "A simplex out of the piece in Mayer-Vietoris.";
+		z. add (i + 1, (Z2integer) 1);
+	}
+	while (!z. empty ())
+	{
+		int row = z. num (z. size () - 1);
+		const Z2chain *col;
+		if (pivot [row] != -1)
+		{
+			col = &reduced. getcol (pivot [row]);
+			const Z2chain &change = v. getcol (pivot [row]);
+			for (int i = 0; i < change. size (); ++ i)
+				bound. add (change. num (i), change. coef (i));
+		}
+		else if (generator [row] != -1)
+		{
+			coordinates [generator [row]] = 1;
+			col = &v. getcol (row);
+		}
+		else
+			throw "Trying to decompose a chain which is not a cycle.";
+		for (int i = 0; i < col -> size (); ++ i)
+			z. add (col -> num (i), col -> coef (i));
+	}
+	if (!preimage)
+		return;
+	for (int i = 0; i < bound. size (); ++ i)
+	{
+		std::vector<int> s = simpleces [bound. num (i) - 1];
+		std::sort (s. begin (), s. end ());
+		toggleSimplex (*preimage, s);
+	}
+	return;
+} /* mayerVietoris::decomposeMatrix */
+
+inline void mayerVietoris::decomposeCone (const simplexSet &cycle, int k,
+	std::vector<char> &coordinates, simplexSet *preimage) const
+{
+	// only the points have homology: the parity of their number
+	if (k == 0)
+		coordinates [0] = cycle. size () & 1;
+	if (!preimage)
+		return;
+
+	// the cone over the chain from the apex bounds it
+	int top = hasse. label (apex);
+	for (const auto &s: cycle)
+	{
+		if (std::binary_search (s. begin (), s. end (), top))
+			continue;
+		std::vector<int> coned (s);
+		coned. insert (std::upper_bound (coned. begin (), coned. end (),
+			top), top);
+		toggleSimplex (*preimage, coned);
+	}
+	return;
+} /* mayerVietoris::decomposeCone */
+
+inline void mayerVietoris::decomposeSplit (simplexSet cycle, int k,
+	std::vector<char> &coordinates, simplexSet *preimage) const
+{
+	auto share = [this] (const simplexSet &chain, simplexSet &inA,
+		simplexSet &inB)
+	{
+		inA. clear ();
+		inB. clear ();
+		for (const auto &s: chain)
+		{
+			if (a -> contains (s))
+				inA. insert (s);
+			else
+				inB. insert (s);
+		}
+	};
+	simplexSet inA, inB, bound;
+	share (cycle, inA, inB);
+
+	// the connecting map: the class of the boundary of the part in A
+	// lies in the kernel of dimension k-1, whose cycles come last
+	if (k > 0)
+	{
+		std::vector<char> gamma;
+		c -> decompose (chainBoundary (inA), k - 1, gamma, 0);
+		const gluing &m = maps [k - 1];
+		int first = basis (k). size () - m. kernel. size ();
+		for (int row = highestEntry (gamma); row != -1;
+			row = highestEntry (gamma))
+		{
+			int j = m. kernelPivots [row];
+			addVector (gamma, m. kernel [j]);
+			coordinates [first + j] = 1;
+			addChain (cycle, bases [k] [first + j]);
+		}
+		share (cycle, inA, inB);
+		std::vector<char> none;
+		c -> decompose (chainBoundary (inA), k - 1, none, &bound);
+	}
+
+	// the cycles in A and in B left, modulo the image of H_k(C)
+	addChain (inA, bound);
+	addChain (inB, bound);
+	std::vector<char> alpha, beta;
+	a -> decompose (inA, k, alpha, 0);
+	b -> decompose (inB, k, beta, 0);
+	alpha. insert (alpha. end (), beta. begin (), beta. end ());
+	std::vector<char> gamma (c -> basis (k). size (), 0);
+	if (k < maps. size ())
+	{
+		const gluing &m = maps [k];
+		for (int row = highestEntry (alpha); row != -1;
+			row = highestEntry (alpha))
+		{
+			if (m. pivots [row] != -1)
+			{
+				addVector (alpha, m. columns [m. pivots [row]]);
+				addVector (gamma, m. combinations [m. pivots [row]]);
+				continue;
+			}
+			coordinates [m. complement [row]] = 1;
+			alpha [row] = 0;
+		}
+	}
+	if (!preimage || (std::find (coordinates. begin (),
+		coordinates. end (), 1) != coordinates. end ()))
+	{
+		return;
+	}
+
+	// the cycles in A and in B differ from a cycle of C by boundaries
+	simplexSet g;
+	for (int i = 0; i < gamma. size (); ++ i)
+	{
+		if (gamma [i])
+			addChain (g, c -> basis (k) [i]);
+	}
+	addChain (inA, g);
+	addChain (inB, g);
+	simplexSet fromA, fromB;
+	std::vector<char> none;
+	a -> decompose (inA, k, none, &fromA);
+	b -> decompose (inB, k, none, &fromB);
+	addChain (fromA, fromB);
+	*preimage = fromA;
+	return;
+} /* mayerVietoris::decomposeSplit */
+
+inline void mayerVietoris::countPieces (int &matrices, int &cones,
+	std::uint64_t &largest) const
+{
+	if (!simpleces. empty ())
+	{
+		++ matrices;
+		largest = std::max (largest, chains);
+	}
+	else if (apex != -1)
+		++ cones;
+	if (a)
+	{
+		a -> countPieces (matrices, cones, largest);
+		b -> countPieces (matrices, cones, largest);
+		c -> countPieces (matrices, cones, largest);
+	}
+	return;
+} /* mayerVietoris::countPieces */
+
+// --------------------------------------------------
+
+/*
+  the homology over Z_2 of the order complex of the poset by the
+  Mayer-Vietoris sequence, reducing no matrix of more than limit maximal
+  chains. only the homology groups are shown.
+*/
+inline void showMayerVietorisHomology(const HasseDiagram& hasse,std::uint64_t limit){
+  orderIndex order(hasse);
+  int n = hasse.size();
+  std::vector<std::uint64_t> all(order.words(),0);
+  for (int u = 0; u < n; ++u)
+    {
+      all[u >> 6] |= (std::uint64_t) 1 << (u & 63);
+    }
+  mayerVietoris homology(hasse,order,all,limit);
+  int matrices = 0, cones = 0;
+  std::uint64_t largest = 0;
+  homology.countPieces(matrices,cones,largest);
+  std::cout << "The order complex was glued by the Mayer-Vietoris sequence from " << matrices << " matrices of at most " << largest << " maximal chains and " << cones << " cones." << std::endl;
+  std::vector<std::uint64_t> betti;
+  for (int k = 0; k < homology.levels(); ++k)
+    {
+      betti.push_back(homology.basis(k).size());
+    }
+  showBettiNumbers(betti,2);
+}
+
+#endif
@@ -0,0 +1,620 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file morse_complex.h
+///
+/// This file contains the class morseComplex, an acyclic matching
+/// (discrete Morse function) on a simplicial complex and the Morse
+/// complex over Z_2 spanned by the simpleces left unmatched.
+/// The homology of the Morse complex is the homology of the complex,
+/// and its boundary matrix is usually much smaller.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef MORSE_COMPLEX_H
+#define MORSE_COMPLEX_H
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <deque>
+#include "simplex_tree.h"
+#include "Z2matrix.h"
+
+class morseComplex;
+
+// --------------------------------------------------
+// ------------------ morseComplex ------------------
+// --------------------------------------------------
+
+/// An acyclic matching on a list of simpleces closed under faces and
+/// sorted as by getChainComplexGenerators. Every simplex is either
+/// critical or matched with a face or a coface of one dimension less
+/// or more. The list must outlive the object.
+class morseComplex
+{
+public:
+	/// Indexes the simpleces; at first all of them are critical.
+	explicit morseComplex (const std::vector<std::vector<int>> &_simpleces);
+
+	/// Matches the simpleces by vertices, one vertex after another in
+	/// the given order: a simplex not containing the vertex is matched
+	/// with the simplex obtained by adding it, if both are critical.
+	/// A sequence of such element matchings is acyclic. With a linear
+	/// extension of a poset this is the lexicographic matching of the
+	/// chains of its order complex.
+	void matchByVertices (const std::vector<int> &vertexOrder);
+
+	/// Returns the number of simpleces.
+	int size () const;
+
+	/// Returns the number of critical simpleces.
+	int criticalNum () const;
+
+	/// Returns true if the simplex is critical.
+	bool isCritical (int i) const;
+
+	/// Returns the simplex matched with the given one or -1.
+	int partner (int i) const;
+
+	/// Appends the indices of the faces of the simplex (none for a vertex).
+	void faces (int i, std::vector<int> &result) const;
+
+	/// Matches the simpleces by a sequence of elementary collapses:
+	/// a simplex with a single coface left is matched with it and both
+	/// are removed; if there is none, the biggest simplex left stays
+	/// critical. Such a sequence is acyclic.
+	void matchByCollapses ();
+
+	/// Matches the simpleces by a sequence of coreductions as in CHomP:
+	/// a simplex with a single face left is matched with it and both are
+	/// removed; a simplex with no face left (at first a vertex) stays
+	/// critical and is removed. The simpleces whose faces change wait in
+	/// a queue. Such a sequence is acyclic.
+	void matchByCoreductions ();
+
+	/// Returns the critical simpleces in the order of the list.
+	std::vector<int> criticalList () const;
+
+	/// Follows the gradient paths from a chain of simpleces (each listed
+	/// once): a simplex matched with a bigger one is replaced by the other
+	/// faces of that one. Appends the critical simpleces left, sorted.
+	/// This is the Morse chain of a cycle, and the Morse boundary of a
+	/// critical simplex when applied to its faces.
+	void project (const std::vector<int> &simplexChain,
+		std::vector<int> &result) const;
+
+	/// Computes the Morse boundary of a critical simplex: the critical
+	/// faces reached from it by an odd number of gradient paths.
+	void morseBoundary (int i, std::vector<int> &result) const;
+
+	/// Lifts a cycle of the Morse complex to a cycle of simpleces with
+	/// the same critical part, adding the bigger simplex matched with
+	/// every face left in its boundary. Appends the simpleces, sorted.
+	void lift (const std::vector<int> &cycle, std::vector<int> &result) const;
+
+	/// Builds the boundary matrix of the Morse complex over Z_2 with
+	/// the augmentation row 0 as in makeBoundaryMatrix. The columns are
+	/// the critical simpleces in the given list.
+	Z2matrix boundaryMatrix (const std::vector<int> &critical) const;
+
+private:
+	/// The simpleces.
+	const std::vector<std::vector<int>> &simpleces;
+
+	/// The vertices of each simplex in the ascending order.
+	std::vector<std::vector<int>> sorted;
+
+	/// The index of the simpleces.
+	simplexTree index;
+
+	/// The simplex matched with each simplex or -1.
+	std::vector<int> match;
+
+	/// The number of critical simpleces.
+	int critical;
+
+	/// Matches two critical simpleces.
+	void pair (int i, int j);
+
+	/// Lists the cofaces of every simplex.
+	void cofaceLists (std::vector<std::vector<int>> &cofaces) const;
+
+}; /* class morseComplex */
+
+// --------------------------------------------------
+
+inline morseComplex::morseComplex
+	(const std::vector<std::vector<int>> &_simpleces):
+	simpleces (_simpleces), sorted (_simpleces), index (_simpleces),
+	match (_simpleces. size (), -1), critical (_simpleces. size ())
+{
+	for (auto &s: sorted)
+		std::sort (s. begin (), s. end ());
+	return;
+} /* morseComplex::morseComplex */
+
+inline int morseComplex::size () const
+{
+	return simpleces. size ();
+} /* morseComplex::size */
+
+inline int morseComplex::criticalNum () const
+{
+	return critical;
+} /* morseComplex::criticalNum */
+
+inline bool morseComplex::isCritical (int i) const
+{
+	return match [i] < 0;
+} /* morseComplex::isCritical */
+
+inline int morseComplex::partner (int i) const
+{
+	return match [i];
+} /* morseComplex::partner */
+
+inline void morseComplex::pair (int i, int j)
+{
+	match [i] = j;
+	match [j] = i;
+	critical -= 2;
+	return;
+} /* morseComplex::pair */
+
+inline void morseComplex::faces (int i, std::vector<int> &result) const
+{
+	if (sorted [i]. size () < 2)
+		return;
+	for (int k = 0; k < static_cast<int> (sorted [i]. size ()); ++ k)
+	{
+		int f = index. findFace (sorted [i], k);
+		if (f >= 0)
+			result. push_back (f);
+	}
+	return;
+} /* morseComplex::faces */
+
+inline void morseComplex::matchByVertices
+	(const std::vector<int> &vertexOrder)
+{
+	// the simpleces of at least two vertices containing each vertex
+	std::unordered_map<int,std::vector<int>> containing;
+	for (int i = 0; i < size (); ++ i)
+	{
+		if (sorted [i]. size () < 2)
+			continue;
+		for (auto v: sorted [i])
+			containing [v]. push_back (i);
+	}
+
+	// every simplex has one face without the vertex, so the pairs
+	// made for one vertex never meet
+	for (auto v: vertexOrder)
+	{
+		std::unordered_map<int,std::vector<int>>::const_iterator it =
+			containing. find (v);
+		if (it == containing. end ())
+			continue;
+		for (auto j: it -> second)
+		{
+			if (match [j] >= 0)
+				continue;
+			int k = std::lower_bound (sorted [j]. begin (),
+				sorted [j]. end (), v) - sorted [j]. begin ();
+			int i = index. findFace (sorted [j], k);
+			if ((i >= 0) && (match [i] < 0))
+				pair (i, j);
+		}
+	}
+	return;
+} /* morseComplex::matchByVertices */
+
+inline void morseComplex::matchByCollapses ()
+{
+	int n = size ();
+	std::vector<std::vector<int>> cofaces;
+	cofaceLists (cofaces);
+	std::vector<int> faceList;
+
+	// the critical simpleces are left; each keeps the number
+	// of its cofaces left, and those with one wait in a queue
+	std::vector<char> left (n, 0);
+	std::vector<int> cofaceNum (n, 0);
+	for (int i = 0; i < n; ++ i)
+		left [i] = (match [i] < 0);
+	// the first vertex of each component is never collapsed, so it is
+	// the critical vertex as in the reduction of the whole complex
+	std::vector<int> root (n);
+	for (int i = 0; i < n; ++ i)
+		root [i] = i;
+	auto findRoot = [&] (int i)
+	{
+		while (root [i] != i)
+			i = root [i] = root [root [i]];
+		return i;
+	};
+	for (int i = 0; i < n; ++ i)
+	{
+		if (sorted [i]. size () != 2)
+			continue;
+		faceList. clear ();
+		faces (i, faceList);
+		if (faceList. size () != 2)
+			continue;
+		int a = findRoot (faceList [0]);
+		int b = findRoot (faceList [1]);
+		root [std::max (a, b)] = std::min (a, b);
+	}
+	std::vector<char> kept (n, 0);
+	for (int i = 0; i < n; ++ i)
+		kept [i] = (sorted [i]. size () == 1) && (findRoot (i) == i);
+	std::vector<int> queue;
+	for (int i = 0; i < n; ++ i)
+	{
+		if (!left [i])
+			continue;
+		for (auto c: cofaces [i])
+			cofaceNum [i] += left [c];
+		if ((cofaceNum [i] == 1) && !kept [i])
+			queue. push_back (i);
+	}
+	auto remove = [&] (int k)
+	{
+		left [k] = 0;
+		faceList. clear ();
+		faces (k, faceList);
+		for (auto f: faceList)
+		{
+			if (left [f] && (-- cofaceNum [f] == 1) && !kept [f])
+				queue. push_back (f);
+		}
+	};
+
+	// the simpleces left are a subcomplex, so the last one is maximal
+	int top = n - 1;
+	while (true)
+	{
+		while (!queue. empty ())
+		{
+			int s = queue. back ();
+			queue. pop_back ();
+			if (!left [s] || (cofaceNum [s] != 1))
+				continue;
+			int t = -1;
+			for (auto c: cofaces [s])
+			{
+				if (left [c])
+					t = c;
+			}
+			pair (s, t);
+			remove (t);
+			remove (s);
+		}
+		while ((top >= 0) && !left [top])
+			-- top;
+		if (top < 0)
+			break;
+		remove (top);
+	}
+	return;
+} /* morseComplex::matchByCollapses */
+
+inline void morseComplex::cofaceLists
+	(std::vector<std::vector<int>> &cofaces) const
+{
+	cofaces. assign (size (), std::vector<int> ());
+	std::vector<int> faceList;
+	for (int i = 0; i < size (); ++ i)
+	{
+		faceList. clear ();
+		faces (i, faceList);
+		for (auto f: faceList)
+			cofaces [f]. push_back (i);
+	}
+	return;
+} /* morseComplex::cofaceLists */
+
+inline void morseComplex::matchByCoreductions ()
+{
+	int n = size ();
+	std::vector<std::vector<int>> cofaces;
+	cofaceLists (cofaces);
+	std::vector<int> faceList;
+
+	// the critical simpleces are left; each keeps the number
+	// of its faces left
+	std::vector<char> left (n, 0);
+	std::vector<int> faceNum (n, 0);
+	for (int i = 0; i < n; ++ i)
+		left [i] = (match [i] < 0);
+	for (int i = 0; i < n; ++ i)
+	{
+		if (!left [i])
+			continue;
+		faceList. clear ();
+		faces (i, faceList);
+		for (auto f: faceList)
+			faceNum [i] += left [f];
+	}
+	std::deque<int> queue;
+	auto remove = [&] (int k)
+	{
+		left [k] = 0;
+		for (auto c: cofaces [k])
+		{
+			if (left [c])
+			{
+				-- faceNum [c];
+				queue. push_back (c);
+			}
+		}
+	};
+
+	// the first simplex left has no face left: the faces come first
+	int first = 0;
+	while (true)
+	{
+		while (!queue. empty ())
+		{
+			int c = queue. front ();
+			queue. pop_front ();
+			if (!left [c] || (faceNum [c] != 1))
+				continue;
+			faceList. clear ();
+			faces (c, faceList);
+			int f = -1;
+			for (auto g: faceList)
+			{
+				if (left [g])
+					f = g;
+			}
+			pair (f, c);
+			remove (f);
+			remove (c);
+		}
+		while ((first < n) && !left [first])
+			++ first;
+		if (first == n)
+			break;
+		remove (first);
+	}
+	return;
+} /* morseComplex::matchByCoreductions */
+
+inline std::vector<int> morseComplex::criticalList () const
+{
+	std::vector<int> critical;
+	for (int i = 0; i < size (); ++ i)
+	{
+		if (match [i] < 0)
+			critical. push_back (i);
+	}
+	return critical;
+} /* morseComplex::criticalList */
+
+inline void morseComplex::project (const std::vector<int> &simplexChain,
+	std::vector<int> &result) const
+{
+	std::unordered_map<int,char> odd;
+	std::vector<int> stack (simplexChain);
+	for (auto f: stack)
+		odd [f] ^= 1;
+	std::vector<int> next;
+	while (!stack. empty ())
+	{
+		int f = stack. back ();
+		stack. pop_back ();
+		int m = match [f];
+		if (!odd [f] || (m < 0) || (sorted [m]. size () < sorted [f]. size ()))
+			continue;
+		odd [f] = 0;
+		next. clear ();
+		faces (m, next);
+		for (auto g: next)
+		{
+			if (g == f)
+				continue;
+			odd [g] ^= 1;
+			stack. push_back (g);
+		}
+	}
+	std::size_t first = result. size ();
+	for (const auto &entry: odd)
+	{
+		if (entry. second && (match [entry. first] < 0))
+			result. push_back (entry. first);
+	}
+	std::sort (result. begin () + first, result. end ());
+	return;
+} /* morseComplex::project */
+
+inline void morseComplex::morseBoundary (int i,
+	std::vector<int> &result) const
+{
+	std::vector<int> faceList;
+	faces (i, faceList);
+	project (faceList, result);
+	return;
+} /* morseComplex::morseBoundary */
+
+inline void morseComplex::lift (const std::vector<int> &cycle,
+	std::vector<int> &result) const
+{
+	// the simpleces added and the boundary of the chain so far
+	std::unordered_map<int,char> added, odd;
+	std::vector<int> stack;
+	for (auto c: cycle)
+	{
+		added [c] ^= 1;
+		faces (c, stack);
+	}
+	for (auto f: stack)
+		odd [f] ^= 1;
+	std::vector<int> next;
+	while (!stack. empty ())
+	{
+		int f = stack. back ();
+		stack. pop_back ();
+		int m = match [f];
+		if (!odd [f] || (m < 0) || (sorted [m]. size () < sorted [f]. size ()))
+			continue;
+		added [m] ^= 1;
+		next. clear ();
+		faces (m, next);
+		for (auto g: next)
+		{
+			odd [g] ^= 1;
+			if (g != f)
+				stack. push_back (g);
+		}
+	}
+	std::size_t first = result. size ();
+	for (const auto &entry: added)
+	{
+		if (entry. second)
+			result. push_back (entry. first);
+	}
+	std::sort (result. begin () + first, result. end ());
+	return;
+} /* morseComplex::lift */
+
+inline Z2matrix morseComplex::boundaryMatrix
+	(const std::vector<int> &critical) const
+{
+	std::vector<int> column (size (), 0);
+	for (int j = 0; j < static_cast<int> (critical. size ()); ++ j)
+		column [critical [j]] = j + 1;
+	int n = critical. size () + 1;
+	Z2matrix boundary = Z2matrix ();
+	boundary. define (n, n);
+	std::vector<int> faceList;
+	for (int j = 0; j < static_cast<int> (critical. size ()); ++ j)
+	{
+		int i = critical [j];
+		if (sorted [i]. size () == 1)
+		{
+			boundary. add (0, j + 1, (Z2integer) 1);
+			continue;
+		}
+		faceList. clear ();
+		morseBoundary (i, faceList);
+		for (auto f: faceList)
+			boundary. add (column [f], j + 1, (Z2integer) 1);
+	}
+	return boundary;
+} /* morseComplex::boundaryMatrix */
+
+// --------------------------------------------------
+
+/* the critical simpleces of the Morse complex, as the simpleces they are */
+inline std::vector<std::vector<int>> morseCells(const std::vector<std::vector<int>>& simpleces,const std::vector<int>& critical){
+  std::vector<std::vector<int>> cells;
+  for (auto i:critical)
+    {
+      cells.push_back(simpleces[i]);
+    }
+  return cells;
+}
+
+/* a cycle of simpleces (column numbers) as a chain of the Morse complex (column numbers) */
+inline Z2chain morseChain(const morseComplex& morse,const Z2chain& simplexChain,const std::vector<int>& critical){
+  std::vector<int> chainList;
+  for (int i = 0; i < simplexChain.size(); ++i)
+    {
+      if (simplexChain.num(i) > 0)
+        {
+          chainList.push_back(simplexChain.num(i) - 1);
+        }
+    }
+  std::vector<int> cells;
+  morse.project(chainList,cells);
+  Z2chain result;
+  for (auto c:cells)
+    {
+      result.add(std::lower_bound(critical.begin(),critical.end(),c) - critical.begin() + 1,(Z2integer) 1);
+    }
+  return result;
+}
+
+/* a cycle of the Morse complex (column numbers) as a cycle of simpleces (column numbers) */
+inline Z2chain simplicialChain(const morseComplex& morse,const Z2chain& cycle,const std::vector<int>& critical){
+  std::vector<int> cells;
+  for (int i = 0; i < cycle.size(); ++i)
+    {
+      if (cycle.num(i) > 0)
+        {
+          cells.push_back(critical[cycle.num(i) - 1]);
+        }
+    }
+  std::vector<int> chainList;
+  morse.lift(cells,chainList);
+  Z2chain result;
+  for (auto i:chainList)
+    {
+      result.add(i + 1,(Z2integer) 1);
+    }
+  return result;
+}
+
+/*
+  the generators of the homology from the reduced Morse complex, chosen
+  as by showHomologyGenerator and shown as cycles of simpleces. the
+  columns of the generators in the Morse complex are put in the list.
+*/
+inline void showMorseHomologyGenerator(const morseComplex& morse,const Z2matrix& reducedBoundary,const Z2matrix& basisChange,const std::vector<std::vector<int>>& simpleces,const std::vector<int>& critical,std::vector<int>& generatorIndexList,const vertexLabels& labels = vertexLabels()){
+  std::vector<std::vector<int>> cells = morseCells(simpleces,critical);
+  int topdim = dimention(simpleces);
+  std::cout << std::endl;
+  for (int p = 0; p < topdim; ++p)
+    {
+      std::vector<Z2chain> chainList;
+      std::vector<int> pLowestList = lowestIndexList(cells,reducedBoundary,p);
+      for (int i = 0; i < cells.size(); ++i)
+        {
+          int index = i + 1;
+          if (cells[i].size() - 1 != p)
+            {
+              continue;
+            }
+          if ((reducedBoundary.getcol(index).empty() || reducedBoundary.getcol(index).num(0) == 0) && (!isIn(pLowestList,index+1)))
+            {
+              chainList.push_back(simplicialChain(morse,basisChange.getcol(index),critical));
+              generatorIndexList.push_back(index);
+            }
+        }
+      std::cout << "The generator(s) of H_" << p << " :"<< std::endl;
+      showChainAsVertex(simpleces,chainList,true,p,labels);
+    }
+}
+
+/* the homology over Z_2 from the Morse complex, shown as by showHomology up to topdim (by default all) */
+inline void showMorseHomology(const morseComplex& morse,const std::vector<std::vector<int>>& simpleces,int topdim = 0){
+  std::vector<int> critical = morse.criticalList();
+  Z2matrix boundary = morse.boundaryMatrix(critical);
+  std::cout << "The Morse complex has " << morse.criticalNum() << " of " << morse.size() << " simpleces." << std::endl;
+  Z2matrix v = Z2matrix();
+  v.identity(boundary.getncols());
+  boundary.reduceBoundary(boundary,v);
+  showHomology(boundary,morseCells(simpleces,critical),(topdim > 0) ? topdim : dimention(simpleces));
+}
+
+#endif
@@ -0,0 +1,200 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file order_index.h
+///
+/// This file contains the class orderIndex, the transitive closure of
+/// a Hasse diagram kept as one bitset of bigger points and one bitset
+/// of smaller points for every point. With it the order relation
+/// is a single bit test.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef ORDER_INDEX_H
+#define ORDER_INDEX_H
+
+#include <vector>
+#include <cstdint>
+#include "hasse_diagram.h"
+
+class orderIndex;
+
+// --------------------------------------------------
+// ------------------- orderIndex -------------------
+// --------------------------------------------------
+
+/// The reachability index of a poset. The bitsets are built in
+/// a topological order of the Hasse diagram, so every set is the OR
+/// of the sets of the covering (or covered) points, one word at a time.
+class orderIndex
+{
+public:
+	/// The default constructor of an empty index.
+	orderIndex ();
+
+	/// Builds the index of the given diagram.
+	explicit orderIndex (const HasseDiagram &hasse);
+
+	/// Returns the diagram the index was built from.
+	const HasseDiagram &diagram () const;
+
+	/// Returns the number of 64-bit words in a bitset.
+	int words () const;
+
+	/// Returns true if the point 'a' is smaller than 'b' (identifiers).
+	bool isBelow (int a, int b) const;
+
+	/// The bitset of the points bigger than the given one.
+	const std::uint64_t *upSet (int id) const;
+
+	/// The bitset of the points smaller than the given one.
+	const std::uint64_t *downSet (int id) const;
+
+private:
+	/// The Hasse diagram.
+	HasseDiagram hasse;
+
+	/// The number of words in a bitset.
+	int w;
+
+	/// The bitsets of the bigger and smaller points, 'w' words each.
+	std::vector<std::uint64_t> up, down;
+
+	/// Fills in the bitsets of the bigger points (upward) or of the
+	/// smaller points. As in biggerMake and smallerMake, nothing is
+	/// collected above a maximal point or below a minimal one.
+	void close (std::vector<std::uint64_t> &bits, bool upward);
+
+}; /* class orderIndex */
+
+// --------------------------------------------------
+
+inline orderIndex::orderIndex (): w (0)
+{
+	return;
+} /* orderIndex::orderIndex */
+
+inline orderIndex::orderIndex (const HasseDiagram &_hasse): hasse (_hasse)
+{
+	int n = hasse. size ();
+	w = (n + 63) / 64;
+	up. assign (static_cast<std::size_t> (n) * w, 0);
+	down. assign (static_cast<std::size_t> (n) * w, 0);
+	close (up, true);
+	close (down, false);
+	return;
+} /* orderIndex::orderIndex */
+
+inline void orderIndex::close (std::vector<std::uint64_t> &bits, bool upward)
+{
+	int n = hasse. size ();
+
+	// count the arrows to be processed first (loops are skipped)
+	std::vector<int> pending (n, 0);
+	std::vector<int> ready;
+	for (int v = 0; v < n; ++ v)
+	{
+		const int *b = upward ? hasse. upBegin (v) : hasse. downBegin (v);
+		const int *e = upward ? hasse. upEnd (v) : hasse. downEnd (v);
+		for (const int *u = b; u != e; ++ u)
+		{
+			if (*u != v)
+				++ pending [v];
+		}
+		if (!pending [v])
+			ready. push_back (v);
+	}
+
+	// go from the top (or the bottom) of the poset
+	std::vector<char> done (n, 0);
+	while (!ready. empty ())
+	{
+		int v = ready. back ();
+		ready. pop_back ();
+		done [v] = 1;
+		std::uint64_t *row = &bits [static_cast<std::size_t> (v) * w];
+		bool stop = upward ? hasse. isMaximal (v) : hasse. isMinimal (v);
+		const int *b = upward ? hasse. upBegin (v) : hasse. downBegin (v);
+		const int *e = upward ? hasse. upEnd (v) : hasse. downEnd (v);
+		for (const int *u = b; !stop && (u != e); ++ u)
+		{
+			if (*u == v)
+				continue;
+			const std::uint64_t *other =
+				&bits [static_cast<std::size_t> (*u) * w];
+			for (int k = 0; k < w; ++ k)
+				row [k] |= other [k];
+			row [*u >> 6] |= (std::uint64_t) 1 << (*u & 63);
+		}
+
+		// the points below (or above) v may be ready now
+		b = upward ? hasse. downBegin (v) : hasse. upBegin (v);
+		e = upward ? hasse. downEnd (v) : hasse. upEnd (v);
+		for (const int *u = b; u != e; ++ u)
+		{
+			if ((*u != v) && !-- pending [*u])
+				ready. push_back (*u);
+		}
+	}
+
+	// the points on a cycle are not a poset; search them one by one
+	for (int v = 0; v < n; ++ v)
+	{
+		if (done [v])
+			continue;
+		std::vector<int> reached;
+		if (upward)
+			hasse. bigger (v, reached);
+		else
+			hasse. smaller (v, reached);
+		std::uint64_t *row = &bits [static_cast<std::size_t> (v) * w];
+		for (auto u: reached)
+			row [u >> 6] |= (std::uint64_t) 1 << (u & 63);
+	}
+	return;
+} /* orderIndex::close */
+
+inline const HasseDiagram &orderIndex::diagram () const
+{
+	return hasse;
+} /* orderIndex::diagram */
+
+inline int orderIndex::words () const
+{
+	return w;
+} /* orderIndex::words */
+
+inline bool orderIndex::isBelow (int a, int b) const
+{
+	return (up [static_cast<std::size_t> (a) * w + (b >> 6)] >> (b & 63)) & 1;
+} /* orderIndex::isBelow */
+
+inline const std::uint64_t *orderIndex::upSet (int v) const
+{
+	return &up [static_cast<std::size_t> (v) * w];
+} /* orderIndex::upSet */
+
+inline const std::uint64_t *orderIndex::downSet (int v) const
+{
+	return &down [static_cast<std::size_t> (v) * w];
+} /* orderIndex::downSet */
+
+#endif
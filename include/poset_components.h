@@ -0,0 +1,326 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file poset_components.h
+///
+/// This file contains the homology of a poset computed one connected
+/// component after another. The components and the generators of H_0
+/// come from union-find over the arrows; the order complex of each
+/// component is built and reduced on its own, in several threads, and
+/// the results are merged and shown as for the whole poset.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef POSET_COMPONENTS_H
+#define POSET_COMPONENTS_H
+
+#include <vector>
+#include <array>
+#include <string>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include "Z2matrix.h"
+
+/*
+  the connected components of the points 0, ..., n-1 joined by the arrows,
+  by union-find with path halving. component[v] is the number of the
+  component of v; the components are numbered by their smallest points,
+  which are put in firstPoints. return the number of the components.
+*/
+inline int connectedComponents(const std::vector<std::array<int,2>>& arrowList,int n,std::vector<int>& component,std::vector<int>& firstPoints){
+  std::vector<int> parent(n);
+  for (int v = 0; v < n; ++v)
+    {
+      parent[v] = v;
+    }
+  auto root = [&parent](int v){
+    while (parent[v] != v)
+      {
+        v = parent[v] = parent[parent[v]];
+      }
+    return v;
+  };
+  for (const auto& arrow:arrowList)
+    {
+      int a = root(arrow[0]);
+      int b = root(arrow[1]);
+      /* the smaller point stays the root */
+      parent[std::max(a,b)] = std::min(a,b);
+    }
+  component.assign(n,-1);
+  firstPoints.clear();
+  for (int v = 0; v < n; ++v)
+    {
+      int r = root(v);
+      if (r == v)
+        {
+          component[v] = firstPoints.size();
+          firstPoints.push_back(v);
+        } else {
+        component[v] = component[r];
+      }
+    }
+  return firstPoints.size();
+}
+
+/* the homology of one component: its simpleces, betti numbers, generators and whitney classes */
+struct componentHomology
+{
+  std::vector<std::vector<int>> simpleces;
+  std::vector<std::uint64_t> betti;
+  /* the generators of dimension at least 1, chosen as by showHomologyGenerator */
+  std::vector<Z2chain> generators;
+  std::vector<int> generatorIndexList;
+  /* the generators of dimension at least 1 in the whitney classes */
+  std::vector<int> whitneyIndexList;
+  /* the parity of the points in the whitney chain of dimension 0 */
+  int whitneyPointParity;
+};
+
+/* reduces the order complex of one component given by its maximal chains and its arrows */
+inline void reduceComponent(const chainTable& maximalChains,const std::vector<std::array<int,2>>& arrowList,bool euler,componentHomology& result){
+  const std::vector<std::vector<int>>& simpleces = result.simpleces = getChainComplexGenerators(maximalChains);
+  Z2matrix boundary = makeBoundaryMatrix(simpleces);
+  Z2matrix v = Z2matrix();
+  v.identity(boundary.getncols());
+  boundary.reduceBoundary(boundary,v);
+  result.betti = bettiNumbers(boundary,simpleces);
+
+  std::vector<int> generatorIndexList;
+  for (int p = 0; p < dimention(simpleces); ++p)
+    {
+      std::vector<int> pLowestList = lowestIndexList(simpleces,boundary,p);
+      for (int i = 0; i < simpleces.size(); ++i)
+        {
+          int index = i + 1;
+          if (simpleces[i].size() - 1 != p)
+            {
+              continue;
+            }
+          if ((boundary.getcol(index).empty() || boundary.getcol(index).num(0) == 0) && (!isIn(pLowestList,index+1)))
+            {
+              generatorIndexList.push_back(index);
+              if (p > 0)
+                {
+                  result.generators.push_back(v.getcol(index));
+                  result.generatorIndexList.push_back(index);
+                }
+            }
+        }
+    }
+
+  result.whitneyPointParity = 0;
+  if (!euler)
+    {
+      return;
+    }
+  Z2matrix inv = v;
+  inv.invert();
+  Z2matrix image = Z2matrix();
+  image.multiply(inv,boundary);
+  Z2chain whitneyChianBefore = makeWhitneyChain(simpleces,arrowList,arrowList.size());
+  for (int i = 0; i < whitneyChianBefore.size(); ++i)
+    {
+      int index = whitneyChianBefore.num(i);
+      if (index > 0 && simpleces[index-1].size() == 1)
+        {
+          result.whitneyPointParity ^= 1;
+        }
+    }
+  Z2matrix c = Z2matrix();
+  c = action(inv,whitneyChianBefore);
+  Z2chain whitneyChainAfter = c.getcol(0);
+  detectWhitneyClass(whitneyChainAfter,image,generatorIndexList);
+  for (auto index:result.generatorIndexList)
+    {
+      if (whitneyChainAfter.findnumber(index) != -1)
+        {
+          result.whitneyIndexList.push_back(index);
+        }
+    }
+}
+
+/*
+  the homology over Z_2 of a poset with two or more components, computed
+  component by component and shown as by showHomology, showHomologyGenerator
+  and showWhitneyClass for the whole poset. the points are the identifiers
+  0, ..., n-1 of the arrows. return false if the poset is connected.
+*/
+inline bool showComponentHomology(const std::vector<std::array<int,2>>& arrowList,int n,bool euler,const vertexLabels& labels,int threads = 0){
+  std::vector<int> component, firstPoints;
+  int m = connectedComponents(arrowList,n,component,firstPoints);
+  if (m < 2)
+    {
+      return false;
+    }
+  std::vector<std::vector<std::array<int,2>>> arrows(m);
+  for (const auto& arrow:arrowList)
+    {
+      arrows[component[arrow[0]]].push_back(arrow);
+    }
+
+  /* the threads take the components one by one, the biggest first */
+  std::vector<int> tasks(m);
+  for (int k = 0; k < m; ++k)
+    {
+      tasks[k] = k;
+    }
+  std::stable_sort(tasks.begin(),tasks.end(),[&](int a,int b){ return arrows[a].size() > arrows[b].size(); });
+  std::vector<componentHomology> results(m);
+  std::atomic<int> next(0);
+  auto work = [&](){
+    for (int k = next++; k < m; k = next++)
+      {
+        int c = tasks[k];
+        HasseDiagram hasse(arrows[c],arrows[c].size());
+        reduceComponent(chainTable(hasse,1),arrows[c],euler,results[c]);
+      }
+  };
+  if (threads <= 0)
+    {
+      threads = std::thread::hardware_concurrency();
+    }
+  threads = std::max(1,std::min(threads,m));
+  std::vector<std::thread> pool;
+  for (int i = 1; i < threads; ++i)
+    {
+      pool.push_back(std::thread(work));
+    }
+  work();
+  for (auto& th:pool)
+    {
+      th.join();
+    }
+
+  /* the simpleces of all the components one after another */
+  std::vector<std::vector<int>> simpleces;
+  std::vector<int> offset(m);
+  std::vector<std::uint64_t> betti;
+  for (int c = 0; c < m; ++c)
+    {
+      offset[c] = simpleces.size();
+      simpleces.insert(simpleces.end(),results[c].simpleces.begin(),results[c].simpleces.end());
+      if (betti.size() < results[c].betti.size())
+        {
+          betti.resize(results[c].betti.size(),0);
+        }
+      for (int p = 1; p < results[c].betti.size(); ++p)
+        {
+          betti[p] += results[c].betti[p];
+        }
+    }
+  betti[0] = m;
+  int topdim = betti.size();
+  showBettiNumbers(betti,2);
+
+  /*
+    the generators in the order of the whole complex. the first point of
+    each component is the only generator of H_0 of the component; as in the
+    reduction of the whole complex, the others are added to the first one.
+  */
+  struct generator
+  {
+    const std::vector<int>* simplex;
+    Z2chain chain;
+    int component;
+    int index;
+  };
+  std::vector<std::vector<generator>> generators(topdim);
+  for (int c = 0; c < m; ++c)
+    {
+      Z2chain z;
+      z.add(offset[0] + 1,(Z2integer) 1);
+      if (c > 0)
+        {
+          z.add(offset[c] + 1,(Z2integer) 1);
+        }
+      generators[0].push_back({&results[c].simpleces[0],z,c,1});
+      for (int k = 0; k < results[c].generators.size(); ++k)
+        {
+          int index = results[c].generatorIndexList[k];
+          Z2chain shifted;
+          const Z2chain& local = results[c].generators[k];
+          for (int i = 0; i < local.size(); ++i)
+            {
+              shifted.add(local.num(i) + offset[c],local.coef(i));
+            }
+          generators[results[c].simpleces[index-1].size() - 1].push_back({&results[c].simpleces[index-1],shifted,c,index});
+        }
+    }
+  std::cout << std::endl;
+  for (int p = 0; p < topdim; ++p)
+    {
+      std::stable_sort(generators[p].begin(),generators[p].end(),[](const generator& a,const generator& b){ return simplexOrder(*a.simplex,*b.simplex); });
+      std::vector<Z2chain> chainList;
+      for (const auto& g:generators[p])
+        {
+          chainList.push_back(g.chain);
+        }
+      std::cout << "The generator(s) of H_" << p << " :"<< std::endl;
+      showChainAsVertex(simpleces,chainList,true,p,labels);
+    }
+
+  if (euler)
+    {
+      /* [first point of c] = g0_1 + g0_c in the generators of the whole complex */
+      int total = 0;
+      for (int c = 0; c < m; ++c)
+        {
+          total ^= results[c].whitneyPointParity;
+        }
+      for (int p = 0; p < topdim; ++p)
+        {
+          std::cout << std::endl;
+          std::cout << " The generator(s) of w_" << p << " :"<< std::endl;
+          std::vector<std::string> whitneygenerators;
+          for (int k = 0; k < generators[p].size(); ++k)
+            {
+              const generator& g = generators[p][k];
+              bool in = (p == 0) ? (k == 0 ? total : results[g.component].whitneyPointParity)
+                : isIn(results[g.component].whitneyIndexList,g.index);
+              if (in)
+                {
+                  std::stringstream ss;
+                  ss << "g" << p <<"_" << k + 1;
+                  whitneygenerators.push_back(ss.str());
+                }
+            }
+          if (whitneygenerators.size() == 0)
+            {
+              std::cout << "None" << std::endl;
+            }
+          else {
+            for (int i = 0; i < whitneygenerators.size()-1; ++i)
+              {
+                std::cout << whitneygenerators[i] << " + " << std::flush;
+              }
+            std::cout << whitneygenerators[whitneygenerators.size()-1] << std::endl;
+          }
+        }
+      std::cout << std::endl;
+    }
+  return true;
+}
+
+#endif
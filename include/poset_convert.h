@@ -41,26 +41,37 @@
 #include <array>
 #include <set>
 #include <map>
+#include <unordered_set>
+#include <cstdint>
+#include "bitmask_simplex.h"
+#include "fixed_simplex.h"
+#include "hasse_diagram.h"
+#include "order_index.h"
+#include "chain_table.h"
+#include "chain_count.h"
+#include "core_reduction.h"
+#include "vertex_labels.h"
+#include "sorted_set.h"
 
 //^\n
-bool isComment(std::string str){
+bool isComment(const std::string& str){
     std::regex comment(";.+");
     return std::regex_match(str,comment);
       }
 
-bool isArrow(std::string str){
+bool isArrow(const std::string& str){
   std::regex arrow("\\{[0-9]+,[0-9]+.",std::regex_constants::extended);
   std::regex arrowEd(".+}",std::regex_constants::extended);
   return std::regex_match(str,arrow) && std::regex_match(str,arrowEd);
     }
 
-bool isSimplex(std::string str){
+bool isSimplex(const std::string& str){
   std::regex smpl("\\{([0-9]+,)*[0-9]+\\}");
   return std::regex_match(str,smpl);
 }
 
 
-bool isDataValid(std::string filename,int& lineNumber){
+bool isDataValid(const std::string& filename,int& lineNumber){
   std::ifstream ifs(filename);
   std::string str;
   if (ifs.fail())
@@ -83,7 +94,7 @@ bool isDataValid(std::string filename,int& lineNumber){
   return true;
 }
 
-bool isDataValid(std::string filename){
+bool isDataValid(const std::string& filename){
   std::ifstream ifs(filename);
   std::string str;
   if (ifs.fail())
@@ -100,7 +111,7 @@ bool isDataValid(std::string filename){
   return true;
 }
 
-bool isValidSimplex(std::string filename){
+bool isValidSimplex(const std::string& filename){
   std::ifstream ifs(filename);
   std::string str;
   if (ifs.fail())
@@ -130,58 +141,41 @@ std::string trim(std::string str){
   return trimed;
 }
 
-std::string fileNameTrim(std::string str){
+std::string fileNameTrim(const std::string& str){
   std::string trimed = str;
   trimed = trimed.erase(str.find_first_of("."));
   return trimed;
 }
 
 
-int str_to_int(std::string str){
+int str_to_int(const std::string& str){
   int ret = -1;
   sscanf(str.c_str(), "%d",&ret);
   return ret;
 }
 
-/* x \in X or not */
-bool isIn(std::vector<int> list,int n){
-  for (auto x:list)
-    {
-      if (n == x){
-        return true;
-      }
-    }
-  return false;
+/* x \in X or not; X need not be sorted (see setContains for sorted lists) */
+bool isIn(const std::vector<int>& list,int n){
+  return std::find(list.begin(),list.end(),n) != list.end();
 }
 
 
 /* return the true when B is subset of A and dimB=dimA-1  B < A*/
-bool isFace(std::vector<int> listA,std::vector<int> listB){
+bool isFace(const std::vector<int>& listA,const std::vector<int>& listB){
   if(listB.size() != listA.size() - 1) return false;
-  for (auto x:listB)
-    {
-      if (!isIn(listA,x)){
-        return false;
-      }
-    }
-  return true;
+  return setIsSubset(sortedSet(listA),sortedSet(listB));
 }
 
 /* return the true when B is subset of A ; B<A */
-bool isSubset(std::vector<int> listA,std::vector<int> listB){
-  for (auto x:listB)
-    {
-      if (!isIn(listA,x)){
-        return false;
-      }
-    }
-  return true;
+bool isSubset(const std::vector<int>& listA,const std::vector<int>& listB){
+  return setIsSubset(sortedSet(listA),sortedSet(listB));
 }
 
 
 
-std::vector<int> maximals(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows){
+std::vector<int> maximals(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows){
   std::vector<int> maximalList;
+  std::vector<int> found;
   int frag = 1;
   for (int i = 0; i < numberOfArrows; ++i)
     {
@@ -197,7 +191,7 @@ std::vector<int> maximals(std::vector<std::array<int,2>> arrowList/* int arrowLi
         }
       if (frag == 1)
         {
-          if (!isIn(maximalList,cand))
+          if (setInsert(found,cand))
             {
               maximalList.push_back(cand);
             }
@@ -206,8 +200,9 @@ std::vector<int> maximals(std::vector<std::array<int,2>> arrowList/* int arrowLi
   return maximalList;
 }
 
-std::vector<int> minimals(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows){
+std::vector<int> minimals(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows){
   std::vector<int> minimalList;
+  std::vector<int> found;
   int frag = 1;
   for (int i = 0; i < numberOfArrows; ++i)
     {
@@ -223,7 +218,7 @@ std::vector<int> minimals(std::vector<std::array<int,2>> arrowList/* int arrowLi
         }
       if (frag == 1)
         {
-          if (!isIn(minimalList,cand))
+          if (setInsert(found,cand))
             {
               minimalList.push_back(cand);
             }
@@ -232,7 +227,7 @@ std::vector<int> minimals(std::vector<std::array<int,2>> arrowList/* int arrowLi
   return minimalList;
 }
 
-void vertexSet(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int>& vertexList){
+void vertexSet(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int>& vertexList){
   for (int i = 0; i < numberOfArrows; ++i)
     {
       vertexList.push_back(arrowList[i][0]);
@@ -242,7 +237,7 @@ void vertexSet(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,
   vertexList.erase(std::unique(vertexList.begin(), vertexList.end()), vertexList.end());
 }
 
-void vertexPairSet(std::vector<std::array<int,2>> arrowList/* ,int arrowList[][2] */,int numberOfArrows,std::vector<std::vector<int>>& pairList){
+void vertexPairSet(const std::vector<std::array<int,2>>& arrowList/* ,int arrowList[][2] */,int numberOfArrows,std::vector<std::vector<int>>& pairList){
   std::vector<int> vertexList;
   vertexSet(arrowList,numberOfArrows,vertexList);
   int k = 0;
@@ -258,7 +253,7 @@ void vertexPairSet(std::vector<std::array<int,2>> arrowList/* ,int arrowList[][2
 }
 
 
-std::vector<int> nexts(std::vector<std::array<int,2>> arrowList/* ,int arrowList[][2] */,int numberOfArrows,int n){
+std::vector<int> nexts(const std::vector<std::array<int,2>>& arrowList/* ,int arrowList[][2] */,int numberOfArrows,int n){
   std::vector<int> nextList;
   for (int i = 0; i < numberOfArrows; ++i)
     {
@@ -270,7 +265,7 @@ std::vector<int> nexts(std::vector<std::array<int,2>> arrowList/* ,int arrowList
   return nextList;
 }
 
-std::vector<int> previous(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,int n){
+std::vector<int> previous(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,int n){
   std::vector<int> previousList;
   for (int i = 0; i < numberOfArrows; ++i)
     {
@@ -283,53 +278,82 @@ std::vector<int> previous(std::vector<std::array<int,2>> arrowList/* int arrowLi
 }
 
 
-void biggerMake(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int> vertexSet,std::vector<int> &bigger,int v){
-  std::vector<int> maximalList = maximals(arrowList,numberOfArrows);
-  if (isIn(maximalList,v))
+/* labels of the points bigger than v, sorted. */
+void biggerMake(const HasseDiagram& hasse,std::vector<int> &bigger,int v){
+  int id = hasse.id(v);
+  if (id != -1)
     {
-    } else {
-    for(auto n: nexts(arrowList,numberOfArrows,v))
-      {
-        bigger.push_back(n);
-        biggerMake(arrowList,numberOfArrows,vertexSet,bigger,n);
-      }
-  }
+      std::vector<int> ids;
+      hasse.bigger(id,ids);
+      for (auto n:ids)
+        {
+          bigger.push_back(hasse.label(n));
+        }
+    }
   std::sort(bigger.begin(), bigger.end());
   bigger.erase(std::unique(bigger.begin(), bigger.end()), bigger.end());
 }
 
-std::vector<int> biggerVertex(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int> vertexSet,int v){
+void biggerMake(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,const std::vector<int>& vertexSet,std::vector<int> &bigger,int v){
+  biggerMake(HasseDiagram(arrowList,numberOfArrows),bigger,v);
+}
+
+std::vector<int> biggerVertex(const HasseDiagram& hasse,int v){
+  std::vector<int> bigger;
+  biggerMake(hasse,bigger,v);
+  return bigger;
+}
+
+std::vector<int> biggerVertex(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,const std::vector<int>& vertexSet,int v){
   std::vector<int> bigger;
   biggerMake(arrowList,numberOfArrows,vertexSet,bigger,v);
   return bigger;
 }
 
-void smallerMake(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int> vertexSet,std::vector<int> &smaller,int v){
-  std::vector<int> minimalList = minimals(arrowList,numberOfArrows);
-  if (isIn(minimalList,v))
+/* labels of the points smaller than v, sorted. */
+void smallerMake(const HasseDiagram& hasse,std::vector<int> &smaller,int v){
+  int id = hasse.id(v);
+  if (id != -1)
     {
-    } else {
-    for(auto n: previous(arrowList,numberOfArrows,v))
-      {
-        smaller.push_back(n);
-        smallerMake(arrowList,numberOfArrows,vertexSet,smaller,n);
-      }
-  }
+      std::vector<int> ids;
+      hasse.smaller(id,ids);
+      for (auto n:ids)
+        {
+          smaller.push_back(hasse.label(n));
+        }
+    }
   std::sort(smaller.begin(), smaller.end());
   smaller.erase(std::unique(smaller.begin(), smaller.end()), smaller.end());
 }
 
-std::vector<int> smallerVertex(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int> vertexSet,int v){
+void smallerMake(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,const std::vector<int>& vertexSet,std::vector<int> &smaller,int v){
+  smallerMake(HasseDiagram(arrowList,numberOfArrows),smaller,v);
+}
+
+std::vector<int> smallerVertex(const HasseDiagram& hasse,int v){
+  std::vector<int> smaller;
+  smallerMake(hasse,smaller,v);
+  return smaller;
+}
+
+std::vector<int> smallerVertex(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,const std::vector<int>& vertexSet,int v){
   std::vector<int> smaller;
   smallerMake(arrowList,numberOfArrows,vertexSet,smaller,v);
   return smaller;
 }
 
-std::vector<int> intersectionSet(std::vector<int> x,std::vector<int> y){
+/* X \cap Y in the order of X */
+std::vector<int> intersectionSet(const std::vector<int>& x,const std::vector<int>& y){
   std::vector<int> intersec;
+  if (std::is_sorted(x.begin(),x.end()) && std::adjacent_find(x.begin(),x.end()) == x.end())
+    {
+      setIntersection(x,sortedSet(y),intersec);
+      return intersec;
+    }
+  std::vector<int> sortedY = sortedSet(y);
   for (auto v:x)
     {
-      if (isIn(y,v))
+      if (setContains(sortedY,v))
         {
           intersec.push_back(v);
         }
@@ -337,62 +361,59 @@ std::vector<int> intersectionSet(std::vector<int> x,std::vector<int> y){
   return intersec;
 }
 
-std::vector<int> unionSet(std::vector<int> x,std::vector<int> y){
+/* X \cup Y, sorted */
+std::vector<int> unionSet(const std::vector<int>& x,const std::vector<int>& y){
   std::vector<int> uni;
-  for (auto v:x)
-    {
-      uni.push_back(v);
-    }
-
-    for (auto w:y)
-    {
-      uni.push_back(w);
-    }
-    std::sort(uni.begin(), uni.end());
-    uni.erase(std::unique(uni.begin(), uni.end()), uni.end());
+  setUnion(sortedSet(x),sortedSet(y),uni);
   return uni;
 }
 
 
-std::vector<int> betweenVertex(std::vector<std::array<int,2>> arrowList/* int arrowList[][2]*/,int numberOfArrows,std::vector<int> vertexSet,int x,int y){
-  std::vector<int> biggerX = biggerVertex(arrowList,numberOfArrows,vertexSet,x);
-  std::vector<int> biggerY = biggerVertex(arrowList,numberOfArrows,vertexSet,y);
-  std::vector<int> smallerX = smallerVertex(arrowList,numberOfArrows,vertexSet,x);
-  std::vector<int> smallerY = smallerVertex(arrowList,numberOfArrows,vertexSet,y);
-  return unionSet(intersectionSet(biggerX,smallerY),intersectionSet(smallerX,biggerY));
-}
-
-int extends(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */, int numberOfArrows,int currentPoint, std::vector<int> &currentSeed,std::vector<std::vector<int>> &resultList){
-  if (isIn(maximals(arrowList,numberOfArrows),currentPoint))
+/* labels of the points between x and y (in either order), sorted. */
+std::vector<int> betweenVertex(const orderIndex& order,int x,int y){
+  std::vector<int> between;
+  const HasseDiagram& hasse = order.diagram();
+  int a = hasse.id(x);
+  int b = hasse.id(y);
+  if (a == -1 || b == -1)
     {
-      resultList.push_back(currentSeed);
-    } else {
-    if (nexts(arrowList,numberOfArrows,currentPoint).empty())
-      {
-      } else {
-      for (auto n:nexts(arrowList,numberOfArrows,currentPoint))
+      return between;
+    }
+  const std::uint64_t* upA = order.upSet(a);
+  const std::uint64_t* upB = order.upSet(b);
+  const std::uint64_t* downA = order.downSet(a);
+  const std::uint64_t* downB = order.downSet(b);
+  for (int k = 0; k < order.words(); ++k)
+    {
+      std::uint64_t word = (upA[k] & downB[k]) | (downA[k] & upB[k]);
+      for (; word != 0; word &= word - 1)
         {
-          std::vector<int> tmp_currentSeed = currentSeed;
-          tmp_currentSeed.push_back(n);
-          extends(arrowList,numberOfArrows,n,tmp_currentSeed,resultList);
+          between.push_back(hasse.label(k * 64 + __builtin_ctzll(word)));
         }
     }
-  }
+  return between;
 }
 
+std::vector<int> betweenVertex(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2]*/,int numberOfArrows,const std::vector<int>& vertexSet,int x,int y){
+  return betweenVertex(orderIndex(HasseDiagram(arrowList,numberOfArrows)),x,y);
+}
 
-void maximalChains(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<std::vector<int>> &resultList){
-  std::vector<int> minlist = minimals(arrowList,numberOfArrows);
-  int size = minlist.size();
-  for (int i = 0; i < size; ++i)
+/* the maximal chains as vectors, for the callers which need them so; the program reads the chainTable itself */
+void maximalChains(const HasseDiagram& hasse,std::vector<std::vector<int>> &resultList){
+  chainTable chains(hasse);
+  resultList.reserve(resultList.size() + chains.size());
+  for (int i = 0; i < chains.size(); ++i)
     {
-       std::vector<int> currentSeed = {minlist[i]};
-       extends(arrowList,numberOfArrows,minlist[i],currentSeed,resultList);
+      resultList.push_back(std::vector<int>(chains.begin(i),chains.end(i)));
     }
 }
 
+void maximalChains(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<std::vector<int>> &resultList){
+  maximalChains(HasseDiagram(arrowList,numberOfArrows),resultList);
+}
+
 
-int numberOfArrow(std::string filename) {
+int numberOfArrow(const std::string& filename) {
   int num = 0;
   if(isDataValid(filename,num))
     {
@@ -401,7 +422,7 @@ int numberOfArrow(std::string filename) {
     return 0;
 }
 
-void makeArrowList(std::string filename,std::vector<std::array<int,2>> &arrowList/* int arrowList[][2] */){
+void makeArrowList(const std::string& filename,std::vector<std::array<int,2>> &arrowList/* int arrowList[][2] */){
   int numberOfArrows = 0;
   if(isDataValid(filename, numberOfArrows)){
 
@@ -432,14 +453,15 @@ void makeArrowList(std::string filename,std::vector<std::array<int,2>> &arrowLis
 }
 
 /* if a < b  in P ,then return true. */
-bool greater(int a,int b,std::vector<int> vertexSet,std::vector<std::array<int,2>> arrowList /* int arrowList[][2] */,int numberOfArrows){
-  if (!(isIn(vertexSet,a) & isIn(vertexSet,b)))
-    {
-      std::cerr << "Nor first and second integer is included vertexSet";
-    }
-  std::vector<int> bigger;
-  bigger = biggerVertex(arrowList,numberOfArrows,vertexSet,a);
-  return isIn(bigger,b);
+bool greater(int a,int b,const orderIndex& order){
+  int x = order.diagram().id(a);
+  int y = order.diagram().id(b);
+  /* a point without arrows is comparable to nothing */
+  return x != -1 && y != -1 && order.isBelow(x,y);
+}
+
+bool greater(int a,int b,const std::vector<int>& vertexSet,const std::vector<std::array<int,2>>& arrowList /* int arrowList[][2] */,int numberOfArrows){
+  return greater(a,b,orderIndex(HasseDiagram(arrowList,numberOfArrows)));
 }
 
 
@@ -449,7 +471,7 @@ void remove(std::vector<int>& vector, int index)
 }
 
 
-std::vector<std::vector<int>> boundary(std::vector<int> chain){
+std::vector<std::vector<int>> boundary(const std::vector<int>& chain){
   std::vector<std::vector<int>> boundaryList;
   int dim = chain.size();
   for (int i = 0; i < dim; ++i)
@@ -461,7 +483,7 @@ std::vector<std::vector<int>> boundary(std::vector<int> chain){
   return boundaryList;
 }
 
-std::string vecToVer(std::vector<int> vec){
+std::string vecToVer(const std::vector<int>& vec){
   std::ostringstream stream;
   stream << "{";
   for (int i = 0; i < vec.size()-1; ++i)
@@ -474,8 +496,8 @@ std::string vecToVer(std::vector<int> vec){
   return stream.str();
 }
 
-int vectorIndex(std::vector<std::vector<int>> list, std::vector<int> element){
-  std::vector<std::vector<int>>::iterator it = std::find(list.begin(),list.end(),element);
+int vectorIndex(const std::vector<std::vector<int>>& list, const std::vector<int>& element){
+  std::vector<std::vector<int>>::const_iterator it = std::find(list.begin(),list.end(),element);
   if (it != list.end()){
     return std::distance(list.begin(),it);
   } else {
@@ -483,7 +505,7 @@ int vectorIndex(std::vector<std::vector<int>> list, std::vector<int> element){
   }
 }
 
-std::string vectorsToString(std::vector<int> former,std::vector<int> latter,std::vector<std::vector<int>> newVertexList){
+std::string vectorsToString(const std::vector<int>& former,const std::vector<int>& latter,const std::vector<std::vector<int>>& newVertexList){
   std::ostringstream stream;
   std::string retString;
   stream << "{";
@@ -496,36 +518,66 @@ std::string vectorsToString(std::vector<int> former,std::vector<int> latter,std:
 }
 
 
-void getAllBoundary(std::vector<std::vector<int>> &newVertexList, std::vector<int> maximalChain){
-  newVertexList.push_back(maximalChain);
-  if (maximalChain.size() != 1)
+/* order of simpleces in the chain complex: by the size, then lexicographic. */
+bool simplexOrder(const std::vector<int>& a,const std::vector<int>& b){
+  if (a.size() != b.size())
+    {
+      return a.size() < b.size();
+    }
+  return a < b;
+}
+
+/* hash of a simplex for the global deduplication of faces. */
+struct simplexHash{
+  std::size_t operator()(const std::vector<int>& simplex) const{
+    std::size_t h = simplex.size();
+    for (auto v:simplex)
+      {
+        h ^= std::hash<int>()(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+      }
+    return h;
+  }
+};
+
+/*
+  every nonempty face of a chain (or a simplex) exactly once.
+  a face is a subset of the positions of the vertices, coded as a bitmask,
+  so the order of the vertices in the chain is preserved.
+*/
+void enumerateFaces(const int* maximalChain,const int* last,std::unordered_set<std::vector<int>,simplexHash>& seen,std::vector<std::vector<int>>& faceList){
+  int size = last - maximalChain;
+  if (size >= 64)
+    {
+      throw "Too long chain to enumerate its faces.";
+    }
+  std::uint64_t all = (size == 0) ? 0 : (~(std::uint64_t) 0 >> (64 - size));
+  std::vector<int> face;
+  face.reserve(size);
+  for (std::uint64_t mask = 1; mask <= all; ++mask)
     {
-      for (auto v : boundary(maximalChain))
+      face.clear();
+      for (int i = 0; i < size; ++i)
+        {
+          if (mask >> i & 1)
+            {
+              face.push_back(maximalChain[i]);
+            }
+        }
+      if (seen.insert(face).second)
         {
-          newVertexList.push_back(v);
-          getAllBoundary(newVertexList,v);
+          faceList.push_back(face);
         }
     }
-    std::sort(newVertexList.begin(), newVertexList.end(),[](const std::vector<int>& a,const std::vector<int>& b){
-      return a[0] < b[0];
-    });
+}
 
-  std::sort(newVertexList.begin(), newVertexList.end(),[](const std::vector<int>& a,const std::vector<int>& b){
-      if(a.size() == b.size()) {
-        for (int i = 0; i < a.size(); ++i)
-          {
-            if (a[i]!=b[i])
-              {
-                return a[i] < b[i];
-              }
-          }
-      } else {
-        return a.size() < b.size();
-      }});
+void getAllBoundary(std::vector<std::vector<int>> &newVertexList, const std::vector<int>& maximalChain){
+  std::unordered_set<std::vector<int>,simplexHash> seen(newVertexList.begin(),newVertexList.end());
+  enumerateFaces(maximalChain.data(),maximalChain.data() + maximalChain.size(),seen,newVertexList);
+  std::sort(newVertexList.begin(), newVertexList.end(),simplexOrder);
   newVertexList.erase(std::unique(newVertexList.begin(), newVertexList.end()), newVertexList.end());
 }
 
-int dimention(std::vector<std::vector<int>> resultList){
+int dimention(const std::vector<std::vector<int>>& resultList){
   int max = 0;
   for(auto x:resultList){
     if (x.size() > max){
@@ -535,7 +587,16 @@ int dimention(std::vector<std::vector<int>> resultList){
   return max;
 }
 
-void showVector(std::vector<int> vec){
+int dimention(const chainTable& chains){
+  int max = 0;
+  for (int i = 0; i < chains.size(); ++i)
+    {
+      max = std::max(max,chains.length(i));
+    }
+  return max;
+}
+
+void showVector(const std::vector<int>& vec){
   std::cout <<"{"<< std::flush;
   for (int i = 0; i < vec.size()-1; ++i)
     {
@@ -545,7 +606,7 @@ void showVector(std::vector<int> vec){
   std::cout << std::endl;
 }
 
-void showChainComplexGenerator(int dim,std::vector<std::vector<int>> newresultList){
+void showChainComplexGenerator(int dim,const std::vector<std::vector<int>>& newresultList){
   if (dim > dimention(newresultList))
     {
       std::cout << "dimention is too large." << std::endl;
@@ -564,19 +625,43 @@ void showChainComplexGenerator(int dim,std::vector<std::vector<int>> newresultLi
   }
 }
 
-std::vector<std::vector<int>> getChainComplexGenerators(std::vector<std::vector<int>> newresultList){
+/* the simpleces of the order complex from its maximal chains, a list of vectors or a chainTable */
+template <class chainList>
+std::vector<std::vector<int>> getChainComplexGenerators(const chainList& newresultList){
   std::vector<std::vector<int>> possibleGen;
-  for (auto  v:newresultList)
+  vertexBits bits(newresultList);
+  int width = maskWidth(bits.size());
+  if (width == 64)
+    {
+      enumerateFacesByMask<mask64>(newresultList,bits,possibleGen);
+    }
+#ifdef MASK128
+  else if (width == 128)
+    {
+      enumerateFacesByMask<mask128>(newresultList,bits,possibleGen);
+    }
+#endif
+  else if (enumerateFacesByFixedSimplex(newresultList,dimention(newresultList),possibleGen))
     {
-      getAllBoundary(possibleGen,v);
+      /* already sorted */
+      return possibleGen;
     }
+  else
+    {
+      std::unordered_set<std::vector<int>,simplexHash> seen;
+      for (int i = 0; i < chainCount(newresultList); ++i)
+        {
+          enumerateFaces(chainBegin(newresultList,i),chainEnd(newresultList,i),seen,possibleGen);
+        }
+    }
+  std::sort(possibleGen.begin(), possibleGen.end(),simplexOrder);
   return possibleGen;
 }
 
 
 /* getMaximalSimplex */
 
-std::vector<std::vector<int>> getMaximalSimplex(std::string file){
+std::vector<std::vector<int>> getMaximalSimplex(const std::string& file){
   std::string filename = file;
   std::vector<std::vector<int>> resultList;
   int numberOfArrows = 0;
@@ -604,6 +689,14 @@ std::vector<std::vector<int>> getMaximalSimplex(std::string file){
   }
 }
 
+/* the maximal simpleces with the dense identifiers of the vertrices */
+std::vector<std::vector<int>> getMaximalSimplex(const std::string& file,vertexLabels &labels){
+  std::vector<std::vector<int>> resultList = getMaximalSimplex(file);
+  labels = vertexLabels(resultList);
+  labels.toIds(resultList);
+  return resultList;
+}
+
 
 
 
@@ -612,43 +705,35 @@ std::vector<std::vector<int>> getMaximalSimplex(std::string file){
 
 /* getMaximalChains */
 
-std::vector<std::vector<int>> getMaximalChains(std::string simplexFile){
+/* the maximal chains with the dense identifiers of the points */
+chainTable getMaximalChains(const std::string& simplexFile,vertexLabels &labels){
   std::string filename = simplexFile;
   int numberOfArrows = 0;
   if(isDataValid(filename, numberOfArrows)){
-    /* int arrowList[numberOfArrows][2]; */
     std::vector<std::array<int,2>> arrowList;
-
-    std::ifstream ifs(filename);
-    std::string str;
-    int arrowIndex = 0;
-    while(getline(ifs,str))
-      {
-        if(isArrow(str))
-          {
-            std::string tmp;
-            std::istringstream strm(str);
-            int vertexIndex = 0;
-            std::array<int,2> test;
-            while(getline(strm,tmp,','))
-              {
-                /* arrowList[arrowIndex][vertexIndex] = str_to_int(trim(tmp));*/
-                /* arrowList[vertexIndex][arrowIndex] = str_to_int(trim(tmp)); */
-                test[vertexIndex] = str_to_int(trim(tmp));
-                vertexIndex += 1;
-              }
-            arrowList.push_back(test);
-          }
-      }
-    std::vector<std::vector<int>> resultList;
-    maximalChains(arrowList,numberOfArrows,resultList);
-    return resultList;
-  } else {
-    std::cerr << "Data is not valid.";
+    makeArrowList(filename,arrowList);
+    labels = vertexLabels(arrowList);
+    labels.toIds(arrowList);
+    return chainTable(HasseDiagram(arrowList,numberOfArrows));
   }
+  std::cerr << "Data is not valid.";
+  return chainTable();
+}
+
+std::vector<std::vector<int>> getMaximalChains(const std::string& simplexFile){
+  vertexLabels labels;
+  chainTable chains = getMaximalChains(simplexFile,labels);
+  std::vector<std::vector<int>> resultList;
+  resultList.reserve(chains.size());
+  for (int i = 0; i < chains.size(); ++i)
+    {
+      resultList.push_back(std::vector<int>(chains.begin(i),chains.end(i)));
+      labels.toLabels(resultList.back());
+    }
+  return resultList;
 }
 
-void makeVertexAndArrowList(std::vector<std::vector<int>> simpleces,std::vector<int> &vertexList,std::vector<std::array<int,2>> &arrowList){
+void makeVertexAndArrowList(const std::vector<std::vector<int>>& simpleces,std::vector<int> &vertexList,std::vector<std::array<int,2>> &arrowList){
   for (int i = 0 ; i < simpleces.size() ; ++i)
     {
       if(simpleces[i].size() == 1){
@@ -664,7 +749,7 @@ void makeVertexAndArrowList(std::vector<std::vector<int>> simpleces,std::vector<
 
 
 /* first index which represent p-dim simplex */
-int beginNum(int p,std::vector<std::vector<int>> simpleces){
+int beginNum(int p,const std::vector<std::vector<int>>& simpleces){
   for (int i = 0; i < simpleces.size(); ++i)
     {
       if (simpleces[i].size() == p)
@@ -675,7 +760,7 @@ int beginNum(int p,std::vector<std::vector<int>> simpleces){
 }
 
 /* last index which represent p-dim simplex*/
-int endNum(int p,std::vector<std::vector<int>> simpleces){
+int endNum(int p,const std::vector<std::vector<int>>& simpleces){
   for (int i = 0; i < simpleces.size(); ++i)
     {
       if (simpleces[i].size() == p + 1)
@@ -685,62 +770,131 @@ int endNum(int p,std::vector<std::vector<int>> simpleces){
     }
 }
 
+/* true if the point w is bigger than v; false if one of them is not a point. */
+inline bool isBiggerPoint(const orderIndex& order,int v,int w){
+  int x = order.diagram().id(v);
+  int y = order.diagram().id(w);
+  return x != -1 && y != -1 && order.isBelow(x,y);
+}
+
 /* totally oreder subsets with vertrces bigger than v.*/
-std::vector<std::vector<int>> biggerSimplex(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int> vertex,std::vector<std::vector<int>> simpleces, int v){
+std::vector<std::vector<int>> biggerSimplex(const orderIndex& order,const std::vector<std::vector<int>>& simpleces, int v){
   std::vector<std::vector<int>> resultList;
   for (auto ch:simpleces)
     {
-      if (isIn(biggerVertex(arrowList,numberOfArrows,vertex,v),ch[0])) resultList.push_back(ch);
+      if (isBiggerPoint(order,v,ch[0])) resultList.push_back(ch);
     }
   return resultList;
 }
 
+std::vector<std::vector<int>> biggerSimplex(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,const std::vector<int>& vertex,const std::vector<std::vector<int>>& simpleces, int v){
+  return biggerSimplex(orderIndex(HasseDiagram(arrowList,numberOfArrows)),simpleces,v);
+}
+
 /* totally oreder subsets with vertrces smaller than v.*/
-std::vector<std::vector<int>> smallerSimplex(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int> vertex,std::vector<std::vector<int>> simpleces, int v){
+std::vector<std::vector<int>> smallerSimplex(const orderIndex& order,const std::vector<std::vector<int>>& simpleces, int v){
   std::vector<std::vector<int>> resultList;
   for (auto ch:simpleces)
     {
-      if (isIn(smallerVertex(arrowList,numberOfArrows,vertex,v),ch[ch.size()-1])) resultList.push_back(ch);
+      if (isBiggerPoint(order,ch[ch.size()-1],v)) resultList.push_back(ch);
     }
   return resultList;
 }
 
+std::vector<std::vector<int>> smallerSimplex(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,const std::vector<int>& vertex,const std::vector<std::vector<int>>& simpleces, int v){
+  return smallerSimplex(orderIndex(HasseDiagram(arrowList,numberOfArrows)),simpleces,v);
+}
+
 /* totally oreder subsets with vertrices between v & w.*/
-std::vector<std::vector<int>> betweenSimplex(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<int> vertex,std::vector<std::vector<int>> simpleces, int v , int w){
+std::vector<std::vector<int>> betweenSimplex(const orderIndex& order,const std::vector<std::vector<int>>& simpleces, int v , int w){
   std::vector<std::vector<int>> resultList;
   for (auto ch:simpleces)
     {
-      if (isIn(smallerVertex(arrowList,numberOfArrows,vertex,v),ch[ch.size()-1])
-          && isIn(smallerVertex(arrowList,numberOfArrows,vertex,w),ch[ch.size()-1])
-          && isIn(biggerVertex(arrowList,numberOfArrows,vertex,v),ch[0])
-          && isIn(biggerVertex(arrowList,numberOfArrows,vertex,w),ch[0])
+      if (isBiggerPoint(order,ch[ch.size()-1],v)
+          && isBiggerPoint(order,ch[ch.size()-1],w)
+          && isBiggerPoint(order,v,ch[0])
+          && isBiggerPoint(order,w,ch[0])
           ) resultList.push_back(ch);
     }
   return resultList;
 }
 
+std::vector<std::vector<int>> betweenSimplex(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,const std::vector<int>& vertex,const std::vector<std::vector<int>>& simpleces, int v , int w){
+  return betweenSimplex(orderIndex(HasseDiagram(arrowList,numberOfArrows)),simpleces,v,w);
+}
+
+
+/*
+  the parities of the simpleces starting (first) and ending (last) at each point.
+  return false if a simplex does not go up from its first vertex to its last one;
+  otherwise no simplex lies between two points and only these parities matter.
+*/
+bool simplexEndParity(const orderIndex& order,const std::vector<std::vector<int>>& simpleces,std::vector<std::uint64_t>& first,std::vector<std::uint64_t>& last){
+  const HasseDiagram& hasse = order.diagram();
+  first.assign(order.words(),0);
+  last.assign(order.words(),0);
+  for (const auto& ch:simpleces)
+    {
+      int x = hasse.id(ch[0]);
+      int y = hasse.id(ch[ch.size()-1]);
+      if (ch.size() > 1 && (x == -1 || y == -1 || !order.isBelow(x,y)))
+        {
+          return false;
+        }
+      if (x != -1)
+        {
+          first[x >> 6] ^= (std::uint64_t) 1 << (x & 63);
+          last[y >> 6] ^= (std::uint64_t) 1 << (y & 63);
+        }
+    }
+  return true;
+}
 
 /*
   euler poset or not
 */
-bool isEuler(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,int numberOfArrows,std::vector<std::vector<int>> simpleces){
+bool isEuler(const HasseDiagram& hasse,const std::vector<std::vector<int>>& simpleces){
+  orderIndex order(hasse);
+  std::vector<std::uint64_t> first,last;
+  if (isAcyclic(order) && simplexEndParity(order,simpleces,first,last))
+    {
+      /* as in the loop below, only the simpleces below each point are counted */
+      for (int v = 0; v < hasse.size(); ++v)
+        {
+          if (parityBelow(order,last,v))
+            {
+              return false;
+            }
+        }
+      return true;
+    }
   int sum = 0;
   std::vector<int> vertex;
-  vertexSet(arrowList,numberOfArrows,vertex);
+  for (int i = 0; i < hasse.size(); ++i)
+    {
+      vertex.push_back(hasse.label(i));
+    }
   int n = vertex.size();
   int pairsNum = (n*(n-1))/2;
-  std::vector< std::vector<int> > pair (pairsNum, std::vector<int>(2));
-  vertexPairSet(arrowList,numberOfArrows,pair);
+  std::vector< std::vector<int> > pair;
+  pair.reserve(pairsNum);
+  for (int i = 0; i < n; ++i)
+    {
+      for (int j = i + 1; j < n; ++j)
+        {
+          pair.push_back({vertex[i],vertex[j]});
+        }
+    }
   for(auto v:vertex)
     {
       sum = 0;
-      sum = biggerSimplex(arrowList,numberOfArrows,vertex,simpleces,v).size();
+      sum = biggerSimplex(order,simpleces,v).size();
       sum = 0;
 
       if (sum % 2 == 1){
         return false;
       }
-      sum = smallerSimplex(arrowList,numberOfArrows,vertex,simpleces,v).size();
+      sum = smallerSimplex(order,simpleces,v).size();
 
       if (sum % 2 == 1){
         return false;
@@ -751,7 +905,7 @@ bool isEuler(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,in
       sum = 0;
       int x = pair[i][0];
       int y = pair[i][1];
-      sum = betweenSimplex(arrowList, numberOfArrows, vertex, simpleces, x , y).size();
+      sum = betweenSimplex(order, simpleces, x , y).size();
       if (sum % 2 == 1){
         return false;
       }
@@ -759,39 +913,40 @@ bool isEuler(std::vector<std::array<int,2>> arrowList/* int arrowList[][2] */,in
   return true;
 }
 
-bool isEuler(std::string filename){
+bool isEuler(const std::vector<std::array<int,2>>& arrowList/* int arrowList[][2] */,int numberOfArrows,const std::vector<std::vector<int>>& simpleces){
+  return isEuler(HasseDiagram(arrowList,numberOfArrows),simpleces);
+}
+
+bool isEuler(const std::string& filename){
   int numberOfArrows = 0;
   if(isDataValid(filename, numberOfArrows)){
-    /* int arrowList[numberOfArrows][2]; */
     std::vector<std::array<int,2>> arrowList;
-    std::ifstream ifs(filename);
-    std::string str;
-    int arrowIndex = 0;
-    while(getline(ifs,str))
+    makeArrowList(filename,arrowList);
+    vertexLabels labels(arrowList);
+    labels.toIds(arrowList);
+    /* the diagram is shared by the maximal chains and the euler check */
+    HasseDiagram hasse(arrowList,numberOfArrows);
+    orderIndex order(hasse);
+    if (isAcyclic(order))
       {
-        if(isArrow(str))
+        /* the simpleces are the chains; their parities are counted without listing them */
+        std::vector<std::uint64_t> last = chainEndParity(order);
+        for (int v = 0; v < hasse.size(); ++v)
           {
-            std::string tmp;
-            std::istringstream strm(str);
-            int vertexIndex = 0;
-            std::array<int,2> test;
-            while(getline(strm,tmp,','))
+            if (parityBelow(order,last,v))
               {
-                /* arrowList[arrowIndex][vertexIndex] = str_to_int(trim(tmp));*/
-                /* arrowList[vertexIndex][arrowIndex] = str_to_int(trim(tmp)); */
-                test[vertexIndex] = str_to_int(trim(tmp));
-                vertexIndex += 1;
+                return false;
               }
-            arrowList.push_back(test);
           }
+        return true;
       }
-    std::vector<std::vector<int>> maximalChains = getMaximalChains(filename);
-    std::vector<std::vector<int>> simpleces = getChainComplexGenerators(maximalChains);
-    return isEuler(arrowList,numberOfArrows,simpleces);
+    std::vector<std::vector<int>> simpleces = getChainComplexGenerators(chainTable(hasse));
+    return isEuler(hasse,simpleces);
   }
+  return false;
 }
 
-bool isEulerSimpComp(std::vector<std::vector<int>> simpleces){
+bool isEulerSimpComp(const std::vector<std::vector<int>>& simpleces){
   int sum = 0;
   std::vector<int> vertexList;
   std::vector<std::array<int,2>> arrowList;
@@ -801,18 +956,32 @@ bool isEulerSimpComp(std::vector<std::vector<int>> simpleces){
   int n = vertexList.size();
   int numberOfArrows = arrowList.size();
   int pairsNum = (n*(n-1))/2;
+  orderIndex order(HasseDiagram(arrowList,numberOfArrows));
+  std::vector<std::uint64_t> first,last;
+  if (isAcyclic(order) && simplexEndParity(order,simpleces,first,last))
+    {
+      for (auto v:vertexList)
+        {
+          int id = order.diagram().id(v);
+          if (id != -1 && (parityAbove(order,first,id) || parityBelow(order,last,id)))
+            {
+              return false;
+            }
+        }
+      return true;
+    }
   std::vector< std::vector<int> > pair (pairsNum, std::vector<int>(2));
   vertexPairSet(arrowList,numberOfArrows,pair);
 
   for(auto v:vertexList)
     {
       sum = 0;
-      sum = biggerSimplex(arrowList,numberOfArrows,vertexList,simpleces,v).size();
+      sum = biggerSimplex(order,simpleces,v).size();
       if (sum % 2 == 1){
         return false;
       }
       sum = 0;
-      sum = smallerSimplex(arrowList,numberOfArrows,vertexList,simpleces,v).size();
+      sum = smallerSimplex(order,simpleces,v).size();
       if (sum % 2 == 1){
         return false;
       }
@@ -822,7 +991,7 @@ bool isEulerSimpComp(std::vector<std::vector<int>> simpleces){
       sum = 0;
       int x = pair[i][0];
       int y = pair[i][1];
-      sum = betweenSimplex(arrowList, numberOfArrows, vertexList, simpleces, x , y).size();
+      sum = betweenSimplex(order, simpleces, x , y).size();
       if (sum % 2 == 1){
         return false;
       }
@@ -0,0 +1,402 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file poset_structure.h
+///
+/// This file contains the decomposition of a finite poset as an ordinal
+/// sum (join) P_1 + P_2 + ... of smaller posets, in which every point of
+/// a part is below every point of the later parts. The order complex is
+/// then the join of the order complexes of the parts, and its homology
+/// over a field comes from the homology of the parts: a part with one
+/// point makes a cone and a part of two incomparable points a suspension.
+/// The order complex of a product of posets is the product of their order
+/// complexes, so the homology of product (*) and join (+) expressions over
+/// poset files comes from the files by the Kunneth formulas.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef POSET_STRUCTURE_H
+#define POSET_STRUCTURE_H
+
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <cctype>
+#include "Z2matrix.h"
+
+/* the bitset of the points (identifiers) */
+inline std::vector<std::uint64_t> pointSet(const orderIndex& order,const std::vector<int>& points){
+  std::vector<std::uint64_t> set(order.words(),0);
+  for (auto v:points)
+    {
+      set[v >> 6] |= (std::uint64_t) 1 << (v & 63);
+    }
+  return set;
+}
+
+/*
+  the parts of the poset as an ordinal sum. the points of the first parts
+  have smaller down sets than the others, so every part is a run of the
+  ascending order; a run ends where all the later points are above it.
+  the poset must be acyclic.
+*/
+inline std::vector<std::vector<int>> joinParts(const orderIndex& order){
+  std::vector<int> points = ascendingOrder(order);
+  int n = points.size();
+  std::vector<std::vector<int>> parts(1);
+  std::vector<std::uint64_t> below(order.words(),0);
+  for (int k = 0; k < n; ++k)
+    {
+      parts.back().push_back(points[k]);
+      below[points[k] >> 6] |= (std::uint64_t) 1 << (points[k] & 63);
+      if (k + 1 == n)
+        {
+          break;
+        }
+      bool cut = true;
+      for (int l = k + 1; l < n && cut; ++l)
+        {
+          const std::uint64_t* down = order.downSet(points[l]);
+          for (int w = 0; w < order.words() && cut; ++w)
+            {
+              cut = (down[w] & below[w]) == below[w];
+            }
+        }
+      if (cut)
+        {
+          parts.push_back(std::vector<int>());
+        }
+    }
+  return parts;
+}
+
+/* true if no two of the points are comparable */
+inline bool isAntichain(const orderIndex& order,const std::vector<int>& points){
+  for (auto u:points)
+    {
+      for (auto v:points)
+        {
+          if (order.isBelow(u,v))
+            {
+              return false;
+            }
+        }
+    }
+  return true;
+}
+
+/* the number of points of the longest chain among the points, given in the ascending order */
+inline int chainHeight(const orderIndex& order,const std::vector<int>& points){
+  std::vector<int> height(points.size(),1);
+  int top = 0;
+  for (int j = 0; j < points.size(); ++j)
+    {
+      for (int i = 0; i < j; ++i)
+        {
+          if (order.isBelow(points[i],points[j]))
+            {
+              height[j] = std::max(height[j],height[i] + 1);
+            }
+        }
+      top = std::max(top,height[j]);
+    }
+  return top;
+}
+
+/*
+  the reduced betti numbers of the order complex of the subposet on the
+  points, with coefficients in Z_p. a point alone is contractible and
+  k incomparable points have \tilde b_0 = k - 1; otherwise the maximal
+  chains of the subposet are reduced as usual.
+*/
+inline std::vector<std::uint64_t> reducedBettiNumbers(const HasseDiagram& hasse,const orderIndex& order,const std::vector<int>& points,int characteristic){
+  if (points.size() == 1)
+    {
+      return std::vector<std::uint64_t>(1,0);
+    }
+  if (isAntichain(order,points))
+    {
+      return std::vector<std::uint64_t>(1,points.size() - 1);
+    }
+  std::vector<std::vector<int>> simpleces = getChainComplexGenerators(inducedMaximalChains(hasse,order,pointSet(order,points)));
+  std::vector<std::uint64_t> betti = bettiNumbersModP(characteristic,simpleces);
+  betti[0] -= 1;
+  return betti;
+}
+
+/* the reduced betti numbers of a join over a field: \tilde b_{k+1}(X*Y) = \sum_{i+j=k} \tilde b_i(X) \tilde b_j(Y) */
+inline std::vector<std::uint64_t> joinBettiNumbers(const std::vector<std::uint64_t>& x,const std::vector<std::uint64_t>& y){
+  std::vector<std::uint64_t> betti(x.size() + y.size(),0);
+  for (int i = 0; i < x.size(); ++i)
+    {
+      for (int j = 0; j < y.size(); ++j)
+        {
+          betti[i+j+1] += x[i] * y[j];
+        }
+    }
+  return betti;
+}
+
+/* the reduced betti numbers of the join of the parts; a cone has none */
+inline std::vector<std::uint64_t> joinReducedBettiNumbers(const HasseDiagram& hasse,const orderIndex& order,const std::vector<std::vector<int>>& parts,int characteristic){
+  for (const auto& part:parts)
+    {
+      if (part.size() == 1)
+        {
+          return std::vector<std::uint64_t>(1,0);
+        }
+    }
+  std::vector<std::uint64_t> reduced = reducedBettiNumbers(hasse,order,parts[0],characteristic);
+  for (int k = 1; k < parts.size(); ++k)
+    {
+      reduced = joinBettiNumbers(reduced,reducedBettiNumbers(hasse,order,parts[k],characteristic));
+    }
+  return reduced;
+}
+
+/* the betti numbers of the dimensions below height from the reduced ones */
+inline std::vector<std::uint64_t> unreducedBettiNumbers(const std::vector<std::uint64_t>& reduced,int height){
+  std::vector<std::uint64_t> betti(height,0);
+  for (int p = 0; p < height && p < reduced.size(); ++p)
+    {
+      betti[p] = reduced[p];
+    }
+  betti[0] += 1;
+  return betti;
+}
+
+/*
+  the homology with coefficients in Z_p of a poset which is the join of
+  two or more parts, computed from the parts and shown as by showHomology.
+  a cone is not reduced at all. return false if the poset is not a join.
+*/
+inline bool showJoinHomology(const HasseDiagram& hasse,int characteristic){
+  orderIndex order(hasse);
+  if (!isAcyclic(order))
+    {
+      return false;
+    }
+  std::vector<std::vector<int>> parts = joinParts(order);
+  if (parts.size() < 2)
+    {
+      return false;
+    }
+  int height = 0;
+  bool cone = false;
+  bool suspension = false;
+  std::cout << "The poset is the join of " << parts.size() << " parts of " << std::flush;
+  for (int k = 0; k < parts.size(); ++k)
+    {
+      std::cout << parts[k].size() << (k + 1 < parts.size() ? ", " : " points.") << std::flush;
+      height += chainHeight(order,parts[k]);
+      cone = cone || parts[k].size() == 1;
+      suspension = suspension || (parts[k].size() == 2 && isAntichain(order,parts[k]));
+    }
+  std::cout << std::endl;
+  if (cone)
+    {
+      std::cout << "The order complex is a cone." << std::endl;
+    } else if (suspension)
+    {
+      std::cout << "The order complex is a suspension." << std::endl;
+    }
+  showBettiNumbers(unreducedBettiNumbers(joinReducedBettiNumbers(hasse,order,parts,characteristic),height),characteristic);
+  return true;
+}
+
+// ------ expressions ------
+
+/* the betti numbers of an order complex and the number of points of its longest chain */
+struct posetHomology
+{
+  std::vector<std::uint64_t> betti;
+  int height;
+};
+
+/* the homology of the poset in a file, from its join parts if it has some */
+inline bool filePosetHomology(const std::string& filename,int characteristic,posetHomology& result){
+  if (!isDataValid(filename))
+    {
+      std::cerr << filename << ": Invalid Data, please check its content." << std::endl;
+      return false;
+    }
+  std::vector<std::array<int,2>> arrows;
+  makeArrowList(filename,arrows);
+  vertexLabels(arrows).toIds(arrows);
+  HasseDiagram hasse(arrows,arrows.size());
+  orderIndex order(hasse);
+  if (isAcyclic(order))
+    {
+      std::vector<std::vector<int>> parts = joinParts(order);
+      result.height = 0;
+      for (const auto& part:parts)
+        {
+          result.height += chainHeight(order,part);
+        }
+      result.betti = unreducedBettiNumbers(joinReducedBettiNumbers(hasse,order,parts,characteristic),result.height);
+      return true;
+    }
+  std::vector<std::vector<int>> simpleces = getChainComplexGenerators(chainTable(hasse));
+  result.betti = bettiNumbersModP(characteristic,simpleces);
+  result.height = result.betti.size();
+  return true;
+}
+
+/* the product: b_k(X x Y) = \sum_{i+j=k} b_i(X) b_j(Y), and a longest chain has h(X) + h(Y) - 1 points */
+inline posetHomology productHomology(const posetHomology& x,const posetHomology& y){
+  posetHomology result;
+  result.height = x.height + y.height - 1;
+  result.betti.assign(result.height,0);
+  for (int i = 0; i < x.betti.size(); ++i)
+    {
+      for (int j = 0; j < y.betti.size(); ++j)
+        {
+          result.betti[i+j] += x.betti[i] * y.betti[j];
+        }
+    }
+  return result;
+}
+
+/* the join (ordinal sum) from the reduced betti numbers */
+inline posetHomology joinHomology(const posetHomology& x,const posetHomology& y){
+  std::vector<std::uint64_t> rx = x.betti, ry = y.betti;
+  rx[0] -= 1;
+  ry[0] -= 1;
+  posetHomology result;
+  result.height = x.height + y.height;
+  result.betti = unreducedBettiNumbers(joinBettiNumbers(rx,ry),result.height);
+  return result;
+}
+
+inline void skipSpaces(const std::string& text,std::size_t& pos){
+  while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+    {
+      ++pos;
+    }
+}
+
+inline bool parseJoin(const std::string& text,std::size_t& pos,int characteristic,posetHomology& result);
+
+/* a file name or an expression in parentheses */
+inline bool parseFactor(const std::string& text,std::size_t& pos,int characteristic,posetHomology& result){
+  skipSpaces(text,pos);
+  if (pos < text.size() && text[pos] == '(')
+    {
+      ++pos;
+      if (!parseJoin(text,pos,characteristic,result))
+        {
+          return false;
+        }
+      skipSpaces(text,pos);
+      if (pos >= text.size() || text[pos] != ')')
+        {
+          std::cerr << "')' is missing in the expression." << std::endl;
+          return false;
+        }
+      ++pos;
+      return true;
+    }
+  std::size_t first = pos;
+  std::size_t last = pos;
+  while (pos < text.size() && text[pos] != '*' && text[pos] != '+' && text[pos] != '(' && text[pos] != ')')
+    {
+      if (!std::isspace(static_cast<unsigned char>(text[pos])))
+        {
+          last = pos + 1;
+        }
+      ++pos;
+    }
+  std::string filename = text.substr(first,last - first);
+  if (filename.empty())
+    {
+      std::cerr << "a file name is missing in the expression." << std::endl;
+      return false;
+    }
+  return filePosetHomology(filename,characteristic,result);
+}
+
+/* factors joined by '*', the product binding tighter than the join */
+inline bool parseProduct(const std::string& text,std::size_t& pos,int characteristic,posetHomology& result){
+  if (!parseFactor(text,pos,characteristic,result))
+    {
+      return false;
+    }
+  skipSpaces(text,pos);
+  while (pos < text.size() && text[pos] == '*')
+    {
+      ++pos;
+      posetHomology factor;
+      if (!parseFactor(text,pos,characteristic,factor))
+        {
+          return false;
+        }
+      result = productHomology(result,factor);
+      skipSpaces(text,pos);
+    }
+  return true;
+}
+
+/* products joined by '+', from the bottom to the top */
+inline bool parseJoin(const std::string& text,std::size_t& pos,int characteristic,posetHomology& result){
+  if (!parseProduct(text,pos,characteristic,result))
+    {
+      return false;
+    }
+  skipSpaces(text,pos);
+  while (pos < text.size() && text[pos] == '+')
+    {
+      ++pos;
+      posetHomology part;
+      if (!parseProduct(text,pos,characteristic,part))
+        {
+          return false;
+        }
+      result = joinHomology(result,part);
+      skipSpaces(text,pos);
+    }
+  return true;
+}
+
+/*
+  the homology with coefficients in Z_p of an expression of poset files,
+  such as "a.txt * b.txt + c.txt": '*' is the product and '+' the join
+  (every point of the left below every point of the right), shown as by
+  showHomology. the order complex of the whole is never built.
+*/
+inline bool showExpressionHomology(const std::string& expression,int characteristic){
+  std::size_t pos = 0;
+  posetHomology result;
+  if (!parseJoin(expression,pos,characteristic,result))
+    {
+      return false;
+    }
+  skipSpaces(expression,pos);
+  if (pos != expression.size())
+    {
+      std::cerr << expression << ": unexpected '" << expression[pos] << "' in the expression." << std::endl;
+      return false;
+    }
+  showBettiNumbers(result.betti,characteristic);
+  return true;
+}
+
+#endif
@@ -0,0 +1,580 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file poset_symmetry.h
+///
+/// This file contains the automorphisms of a Hasse diagram, found by
+/// color refinement and individualization as in canonical labeling, and
+/// their use on the order complex: the chains are enumerated one per
+/// orbit, and over Z_2 the homology of the complex of simplex orbits is
+/// the invariant part of the homology by the transfer when the
+/// automorphism group has odd order.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef POSET_SYMMETRY_H
+#define POSET_SYMMETRY_H
+
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include "Z2matrix.h"
+#include "chain_count.h"
+
+/// The largest automorphism group whose elements are listed to find its order.
+#ifndef SYMMETRYGROUPLIMIT
+#define SYMMETRYGROUPLIMIT 20000
+#endif
+
+/*
+  the stable coloring of the points of two copies of the diagram (the
+  points n, ..., 2n-1 are the second copy) by color refinement: two points
+  keep the same color only if they have as many upper and lower covers of
+  each color. the colors are numbered in the order of their signatures,
+  so the same colors in the two copies mean the same thing.
+*/
+inline std::vector<int> refineColors(const HasseDiagram& hasse,std::vector<int> colors){
+  int n = hasse.size();
+  int count = std::set<int>(colors.begin(),colors.end()).size();
+  while (true)
+    {
+      std::vector<std::vector<int>> signature(2 * n);
+      for (int x = 0; x < 2 * n; ++x)
+        {
+          int v = x % n;
+          int shift = x - v;
+          std::vector<int>& s = signature[x];
+          s.push_back(colors[x]);
+          std::vector<int> up, down;
+          for (const int* u = hasse.upBegin(v); u != hasse.upEnd(v); ++u)
+            {
+              up.push_back(colors[*u + shift]);
+            }
+          for (const int* u = hasse.downBegin(v); u != hasse.downEnd(v); ++u)
+            {
+              down.push_back(colors[*u + shift]);
+            }
+          std::sort(up.begin(),up.end());
+          std::sort(down.begin(),down.end());
+          s.push_back(up.size());
+          s.insert(s.end(),up.begin(),up.end());
+          s.insert(s.end(),down.begin(),down.end());
+        }
+      std::map<std::vector<int>,int> names;
+      for (const auto& s:signature)
+        {
+          names.insert(std::make_pair(s,0));
+        }
+      int k = 0;
+      for (auto& name:names)
+        {
+          name.second = k++;
+        }
+      for (int x = 0; x < 2 * n; ++x)
+        {
+          colors[x] = names[signature[x]];
+        }
+      if (k == count)
+        {
+          return colors;
+        }
+      count = k;
+    }
+}
+
+/* true if the permutation of the identifiers maps the arrows onto the arrows */
+inline bool isAutomorphism(const HasseDiagram& hasse,const std::vector<int>& perm){
+  for (int v = 0; v < hasse.size(); ++v)
+    {
+      std::vector<int> image, target(hasse.upBegin(perm[v]),hasse.upEnd(perm[v]));
+      for (const int* u = hasse.upBegin(v); u != hasse.upEnd(v); ++u)
+        {
+          image.push_back(perm[*u]);
+        }
+      std::sort(image.begin(),image.end());
+      std::sort(target.begin(),target.end());
+      if (image != target)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+/*
+  an automorphism compatible with the coloring of the two copies, found by
+  individualizing a point of the first copy together with each point of the
+  second copy of the same color, refining and going on until every color
+  has one point. budget bounds the number of the refinements.
+*/
+inline bool extendAutomorphism(const HasseDiagram& hasse,const std::vector<int>& colors,std::vector<int>& perm,int& budget){
+  int n = hasse.size();
+  std::vector<int> first(2 * n,0), second(2 * n,0);
+  std::vector<int> size(2 * n,0);
+  for (int x = 0; x < 2 * n; ++x)
+    {
+      (x < n ? first : second)[colors[x]] += 1;
+    }
+  if (first != second)
+    {
+      return false;
+    }
+  /* the first color of more than one point */
+  int x = -1;
+  for (int v = 0; v < n && x == -1; ++v)
+    {
+      if (first[colors[v]] > 1)
+        {
+          x = v;
+        }
+    }
+  if (x == -1)
+    {
+      std::vector<int> point(2 * n,-1);
+      for (int v = 0; v < n; ++v)
+        {
+          point[colors[v + n]] = v;
+        }
+      perm.assign(n,0);
+      for (int v = 0; v < n; ++v)
+        {
+          perm[v] = point[colors[v]];
+        }
+      return isAutomorphism(hasse,perm);
+    }
+  for (int y = n; y < 2 * n; ++y)
+    {
+      if (colors[y] != colors[x] || budget <= 0)
+        {
+          continue;
+        }
+      --budget;
+      std::vector<int> next = colors;
+      next[x] = next[y] = 2 * n;
+      if (extendAutomorphism(hasse,refineColors(hasse,next),perm,budget))
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+/*
+  the colors of the points of two copies of the diagram in which every
+  point of fixed has a color of its own, the same in both copies.
+*/
+inline std::vector<int> fixedColors(int n,const std::vector<int>& fixed){
+  std::vector<int> colors(2 * n,0);
+  for (int i = 0; i < fixed.size(); ++i)
+    {
+      colors[fixed[i]] = colors[fixed[i] + n] = i + 1;
+    }
+  return colors;
+}
+
+/* an automorphism fixing the points of fixed and mapping the point v to the point w, if one is found */
+inline bool findAutomorphism(const HasseDiagram& hasse,const std::vector<int>& fixed,int v,int w,std::vector<int>& perm,int& budget){
+  int n = hasse.size();
+  std::vector<int> colors = fixedColors(n,fixed);
+  colors[v] = colors[w + n] = fixed.size() + 1;
+  return extendAutomorphism(hasse,refineColors(hasse,colors),perm,budget);
+}
+
+/*
+  generators of the automorphisms found which fix the points of fixed, as
+  permutations of the identifiers. for each point, an automorphism to it
+  from the first point of its color is looked for unless one is known;
+  orbit[v] is the smallest point of the orbit of v found. budget bounds the
+  number of the refinements; the search is complete if some of it is left.
+*/
+inline std::vector<std::vector<int>> automorphismGenerators(const HasseDiagram& hasse,std::vector<int>& orbit,const std::vector<int>& fixed,int& budget){
+  int n = hasse.size();
+  std::vector<int> colors = refineColors(hasse,fixedColors(n,fixed));
+  std::vector<int> parent(n);
+  for (int v = 0; v < n; ++v)
+    {
+      parent[v] = v;
+    }
+  auto root = [&parent](int v){
+    while (parent[v] != v)
+      {
+        v = parent[v] = parent[parent[v]];
+      }
+    return v;
+  };
+  std::vector<std::vector<int>> generators;
+  std::map<int,int> firstOfColor;
+  for (int v = 0; v < n; ++v)
+    {
+      int r = firstOfColor.insert(std::make_pair(colors[v],v)).first->second;
+      std::vector<int> perm;
+      if (root(r) == root(v) || !findAutomorphism(hasse,fixed,r,v,perm,budget))
+        {
+          continue;
+        }
+      generators.push_back(perm);
+      for (int u = 0; u < n; ++u)
+        {
+          int a = root(u);
+          int b = root(perm[u]);
+          parent[std::max(a,b)] = std::min(a,b);
+        }
+    }
+  orbit.assign(n,0);
+  for (int v = 0; v < n; ++v)
+    {
+      orbit[v] = root(v);
+    }
+  return generators;
+}
+
+/* the automorphisms found which fix the points of a chain, and their orbits */
+struct stabilizer
+{
+  std::vector<int> orbit;
+  std::vector<std::vector<int>> generators;
+  /* false if the search was cut short by its budget */
+  bool complete;
+};
+
+/* the stabilizers of the chains searched so far, by the chains */
+typedef std::map<std::vector<int>,stabilizer> stabilizerCache;
+
+/* the stabilizer of the points of the chain, searched only once */
+inline const stabilizer& stabilizerOf(const HasseDiagram& hasse,const std::vector<int>& chain,stabilizerCache& cache){
+  auto found = cache.find(chain);
+  if (found != cache.end())
+    {
+      return found->second;
+    }
+  stabilizer& s = cache[chain];
+  int budget = 100000;
+  s.generators = automorphismGenerators(hasse,s.orbit,chain,budget);
+  s.complete = budget > 0;
+  return s;
+}
+
+/* the order of the group generated, or 0 if it has more than SYMMETRYGROUPLIMIT elements */
+inline std::uint64_t groupOrder(const std::vector<std::vector<int>>& generators,int n){
+  std::vector<int> identity(n);
+  for (int v = 0; v < n; ++v)
+    {
+      identity[v] = v;
+    }
+  std::set<std::vector<int>> group;
+  group.insert(identity);
+  std::vector<std::vector<int>> stack(1,identity);
+  while (!stack.empty())
+    {
+      std::vector<int> g = stack.back();
+      stack.pop_back();
+      for (const auto& s:generators)
+        {
+          std::vector<int> h(n);
+          for (int v = 0; v < n; ++v)
+            {
+              h[v] = s[g[v]];
+            }
+          if (group.insert(h).second)
+            {
+              if (group.size() > SYMMETRYGROUPLIMIT)
+                {
+                  return 0;
+                }
+              stack.push_back(h);
+            }
+        }
+    }
+  return group.size();
+}
+
+
+/*
+  appends one chain (identifiers from the bottom up) of every orbit of the
+  chains extending the given one by a point of candidates and then going up,
+  without listing the others: a point is taken only if it is the smallest of
+  its orbit under the automorphisms fixing the chain, which map the
+  candidates onto themselves. maximal: only the maximal chains, going up by
+  covers; otherwise every chain, going up to any bigger point.
+*/
+inline void appendOrbitChains(const HasseDiagram& hasse,const orderIndex& order,std::vector<int>& chain,const std::vector<int>& candidates,bool maximal,stabilizerCache& cache,std::vector<std::vector<int>>& result){
+  const std::vector<int>& orbit = stabilizerOf(hasse,chain,cache).orbit;
+  std::vector<int> representatives;
+  for (auto u:candidates)
+    {
+      if (orbit[u] == u)
+        {
+          representatives.push_back(u);
+        }
+    }
+  for (auto u:representatives)
+    {
+      chain.push_back(u);
+      std::vector<int> next;
+      if (maximal)
+        {
+          for (const int* w = hasse.upBegin(u); w != hasse.upEnd(u); ++w)
+            {
+              if (*w != u)
+                {
+                  next.push_back(*w);
+                }
+            }
+          std::sort(next.begin(),next.end());
+          next.erase(std::unique(next.begin(),next.end()),next.end());
+        } else {
+        const std::uint64_t* up = order.upSet(u);
+        for (int k = 0; k < order.words(); ++k)
+          {
+            for (std::uint64_t word = up[k]; word != 0; word &= word - 1)
+              {
+                next.push_back(k * 64 + __builtin_ctzll(word));
+              }
+          }
+      }
+      if (!maximal || next.empty())
+        {
+          result.push_back(chain);
+        }
+      if (!next.empty())
+        {
+          appendOrbitChains(hasse,order,chain,next,maximal,cache,result);
+        }
+      chain.pop_back();
+    }
+}
+
+/*
+  the chain of the orbit of a chain (identifiers from the bottom up) which
+  appendOrbitChains lists: point by point, the rest of the chain is moved by
+  an automorphism fixing the points before until the point is the smallest
+  of its orbit. the automorphism is composed of the generators found.
+*/
+inline std::vector<int> canonicalChain(const HasseDiagram& hasse,std::vector<int> chain,stabilizerCache& cache){
+  std::vector<int> fixed;
+  for (int i = 0; i < chain.size(); ++i)
+    {
+      const stabilizer& s = stabilizerOf(hasse,fixed,cache);
+      int r = s.orbit[chain[i]];
+      if (r != chain[i])
+        {
+          /* breadth first from chain[i]: reached[p] maps chain[i] to p */
+          std::vector<int> identity(hasse.size());
+          for (int v = 0; v < hasse.size(); ++v)
+            {
+              identity[v] = v;
+            }
+          std::map<int,std::vector<int>> reached;
+          reached[chain[i]] = identity;
+          std::vector<int> queue(1,chain[i]);
+          for (int q = 0; q < queue.size() && !reached.count(r); ++q)
+            {
+              std::vector<int> g = reached[queue[q]];
+              for (const auto& gen:s.generators)
+                {
+                  if (reached.count(gen[queue[q]]))
+                    {
+                      continue;
+                    }
+                  std::vector<int> h(g.size());
+                  for (int v = 0; v < g.size(); ++v)
+                    {
+                      h[v] = gen[g[v]];
+                    }
+                  reached[gen[queue[q]]] = h;
+                  queue.push_back(gen[queue[q]]);
+                }
+            }
+          const std::vector<int>& g = reached.at(r);
+          for (int j = i; j < chain.size(); ++j)
+            {
+              chain[j] = g[chain[j]];
+            }
+        }
+      fixed.push_back(r);
+    }
+  return fixed;
+}
+
+/*
+  the betti numbers over Z_2 of the complex of the orbits of the simpleces,
+  given by one chain of every orbit: the boundary of an orbit is the sum of
+  the orbits of the faces of its chain. by the transfer this is the part of
+  the homology fixed by the automorphisms when they form a group of odd
+  order.
+*/
+inline std::vector<std::uint64_t> orbitBettiNumbers(const HasseDiagram& hasse,std::vector<std::vector<int>> chains,stabilizerCache& cache){
+  auto labelsOf = [&hasse](const std::vector<int>& chain){
+    std::vector<int> labels;
+    for (auto v:chain)
+      {
+        labels.push_back(hasse.label(v));
+      }
+    return labels;
+  };
+  std::stable_sort(chains.begin(),chains.end(),[&](const std::vector<int>& a,const std::vector<int>& b){ return simplexOrder(labelsOf(a),labelsOf(b)); });
+  std::map<std::vector<int>,int> column;
+  std::vector<std::vector<int>> simpleces;
+  for (int j = 0; j < chains.size(); ++j)
+    {
+      column[chains[j]] = j + 1;
+      simpleces.push_back(labelsOf(chains[j]));
+    }
+  Z2matrix boundary = Z2matrix();
+  boundary.define(chains.size() + 1,chains.size() + 1);
+  for (int j = 0; j < chains.size(); ++j)
+    {
+      if (chains[j].size() == 1)
+        {
+          boundary.add(0,j + 1,(Z2integer) 1);
+          continue;
+        }
+      for (int k = 0; k < chains[j].size(); ++k)
+        {
+          std::vector<int> face = chains[j];
+          face.erase(face.begin() + k);
+          boundary.add(column.at(canonicalChain(hasse,face,cache)),j + 1,(Z2integer) 1);
+        }
+    }
+  Z2matrix v = Z2matrix();
+  v.identity(boundary.getncols());
+  boundary.reduceBoundary(boundary,v);
+  return bettiNumbers(boundary,simpleces);
+}
+
+/* the number of the maximal chains, counted from the bottom up modulo 2^64 */
+inline std::uint64_t maximalChainNumber(const orderIndex& order){
+  const HasseDiagram& hasse = order.diagram();
+  std::vector<std::uint64_t> below(hasse.size(),0);
+  std::uint64_t total = 0;
+  for (auto v:ascendingOrder(order))
+    {
+      bool minimal = true, maximal = true;
+      for (const int* w = hasse.downBegin(v); w != hasse.downEnd(v); ++w)
+        {
+          if (*w != v)
+            {
+              below[v] += below[*w];
+              minimal = false;
+            }
+        }
+      for (const int* w = hasse.upBegin(v); w != hasse.upEnd(v); ++w)
+        {
+          maximal = maximal && (*w == v);
+        }
+      if (minimal)
+        {
+          below[v] = 1;
+        }
+      if (maximal)
+        {
+          total += below[v];
+        }
+    }
+  return total;
+}
+
+/*
+  shows the automorphisms found and enumerates the maximal chains up to
+  them. if invariant and the group has odd order, the order complex is
+  enumerated up to the automorphisms too and the homology over Z_2 fixed by
+  them is shown; return true then, and false if the order complex is still
+  to be used.
+*/
+inline bool showSymmetry(const HasseDiagram& hasse,bool invariant = true){
+  orderIndex order(hasse);
+  stabilizerCache cache;
+  int n = hasse.size();
+  const stabilizer& group = stabilizerOf(hasse,std::vector<int>(),cache);
+  int pointOrbits = 0;
+  for (int v = 0; v < n; ++v)
+    {
+      pointOrbits += (group.orbit[v] == v);
+    }
+  std::cout << "The automorphisms found have " << group.generators.size() << " generator(s); the " << n << " points fall into " << pointOrbits << " orbit(s)." << std::endl;
+  if (group.generators.empty())
+    {
+      return false;
+    }
+
+  /* the maximal chains up to symmetry, from the minimal points */
+  std::vector<int> minimals;
+  for (int v = 0; v < n; ++v)
+    {
+      bool minimal = true;
+      for (const int* w = hasse.downBegin(v); w != hasse.downEnd(v); ++w)
+        {
+          minimal = minimal && (*w == v);
+        }
+      if (minimal)
+        {
+          minimals.push_back(v);
+        }
+    }
+  std::vector<int> chain;
+  std::vector<std::vector<int>> maximalChains;
+  appendOrbitChains(hasse,order,chain,minimals,true,cache,maximalChains);
+  for (const auto& s:cache)
+    {
+      if (!s.second.complete)
+        {
+          std::cout << "The search for automorphisms was cut short; the order complex is used." << std::endl;
+          return false;
+        }
+    }
+  std::cout << "Up to symmetry, " << maximalChains.size() << " of the " << maximalChainNumber(order) << " maximal chains were enumerated." << std::endl;
+
+  if (!invariant)
+    {
+      return false;
+    }
+  std::uint64_t size = groupOrder(group.generators,n);
+  if (size == 0)
+    {
+      std::cout << "The automorphism group has more than " << SYMMETRYGROUPLIMIT << " elements; the order complex is used." << std::endl;
+      return false;
+    }
+  if (size % 2 == 0)
+    {
+      std::cout << "The automorphism group has order " << size << ", which is even, so the transfer is not valid over Z_2; the order complex is used." << std::endl;
+      return false;
+    }
+  std::vector<int> points(n);
+  for (int v = 0; v < n; ++v)
+    {
+      points[v] = v;
+    }
+  std::vector<std::vector<int>> chains;
+  appendOrbitChains(hasse,order,chain,points,false,cache,chains);
+  std::uint64_t total = 0;
+  for (auto f:fVector(order))
+    {
+      total += f;
+    }
+  std::cout << "The automorphism group has odd order " << size << "; the homology over Z_2 fixed by it, from " << chains.size() << " orbits of the " << total << " simpleces:" << std::endl;
+  showBettiNumbers(orbitBettiNumbers(hasse,chains,cache),2);
+  return true;
+}
+
+#endif
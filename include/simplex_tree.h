@@ -0,0 +1,178 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file simplex_tree.h
+///
+/// This file contains the class simplexTree, an index of simpleces
+/// which is used to find the column of a face in the boundary matrix.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef SIMPLEX_TREE_H
+#define SIMPLEX_TREE_H
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+class simplexTree;
+
+// --------------------------------------------------
+// ------------------ simplexTree -------------------
+// --------------------------------------------------
+
+/// A trie over the sorted vertex labels of simpleces.
+/// Every simplex is a path from the root, and the node at the end of
+/// the path keeps the index of the simplex in the list it was built from.
+/// A simplex with k vertices is found in O(k) steps.
+class simplexTree
+{
+public:
+	/// The default constructor of an empty tree.
+	simplexTree ();
+
+	/// Builds the tree of the given simpleces list.
+	/// The i-th simplex gets the identifier i.
+	explicit simplexTree (const std::vector<std::vector<int>> &simpleces);
+
+	/// Adds a simplex with the given identifier.
+	/// The vertices may be listed in any order.
+	void insert (std::vector<int> simplex, int id);
+
+	/// Returns the identifier of the simplex or -1 if not found.
+	/// The vertices may be listed in any order.
+	int find (std::vector<int> simplex) const;
+
+	/// Returns the identifier of the face of a sorted simplex which is
+	/// obtained by deleting the vertex at the position 'skip',
+	/// or -1 if the face is not in the tree.
+	int findFace (const std::vector<int> &sorted, int skip) const;
+
+	/// Returns the number of simpleces in the tree.
+	int size () const;
+
+private:
+	/// A node of the trie. The root has no label.
+	struct node
+	{
+		/// The identifier of the simplex ending here, or -1.
+		int id;
+
+		/// The children sorted by their vertex label.
+		std::map<int,int> children;
+	};
+
+	/// The nodes; the root is nodes [0].
+	std::vector<node> nodes;
+
+	/// The number of simpleces in the tree.
+	int count;
+
+	/// Returns the child of the node with the given label or -1.
+	int child (int n, int label) const;
+
+}; /* class simplexTree */
+
+// --------------------------------------------------
+
+inline simplexTree::simplexTree (): nodes (1), count (0)
+{
+	nodes [0]. id = -1;
+	return;
+} /* simplexTree::simplexTree */
+
+inline simplexTree::simplexTree
+	(const std::vector<std::vector<int>> &simpleces): nodes (1), count (0)
+{
+	nodes [0]. id = -1;
+	for (int i = 0; i < static_cast<int> (simpleces. size ()); ++ i)
+		insert (simpleces [i], i);
+	return;
+} /* simplexTree::simplexTree */
+
+inline int simplexTree::child (int n, int label) const
+{
+	std::map<int,int>::const_iterator it = nodes [n]. children. find (label);
+	if (it == nodes [n]. children. end ())
+		return -1;
+	return it -> second;
+} /* simplexTree::child */
+
+inline void simplexTree::insert (std::vector<int> simplex, int id)
+{
+	std::sort (simplex. begin (), simplex. end ());
+	int n = 0;
+	for (auto v: simplex)
+	{
+		int next = child (n, v);
+		if (next < 0)
+		{
+			next = nodes. size ();
+			nodes. push_back (node ());
+			nodes. back (). id = -1;
+			nodes [n]. children [v] = next;
+		}
+		n = next;
+	}
+
+	// the first identifier given to a simplex is kept
+	if (nodes [n]. id < 0)
+	{
+		nodes [n]. id = id;
+		++ count;
+	}
+	return;
+} /* simplexTree::insert */
+
+inline int simplexTree::find (std::vector<int> simplex) const
+{
+	std::sort (simplex. begin (), simplex. end ());
+	int n = 0;
+	for (auto v: simplex)
+	{
+		n = child (n, v);
+		if (n < 0)
+			return -1;
+	}
+	return nodes [n]. id;
+} /* simplexTree::find */
+
+inline int simplexTree::findFace (const std::vector<int> &sorted,
+	int skip) const
+{
+	int n = 0;
+	for (int i = 0; i < static_cast<int> (sorted. size ()); ++ i)
+	{
+		if (i == skip)
+			continue;
+		n = child (n, sorted [i]);
+		if (n < 0)
+			return -1;
+	}
+	return nodes [n]. id;
+} /* simplexTree::findFace */
+
+inline int simplexTree::size () const
+{
+	return count;
+} /* simplexTree::size */
+
+#endif
@@ -0,0 +1,265 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file sorted_set.h
+///
+/// This file contains the set algebra on sorted lists of integers:
+/// membership, subset, intersection and union by merging, with
+/// a galloping search when one list is much shorter than the other
+/// and a block intersection with SSE2 for long lists of similar length.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef SORTED_SET_H
+#define SORTED_SET_H
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/// The ratio of the lengths above which the galloping search is used.
+#ifndef GALLOPRATIO
+#define GALLOPRATIO 16
+#endif
+
+// --------------------------------------------------
+// -------------------- sortedView ------------------
+// --------------------------------------------------
+
+/// A read-only view of a sorted list of distinct integers.
+/// It does not own the data; the list must outlive the view.
+struct sortedView
+{
+	const int *first;
+	const int *last;
+
+	sortedView (): first (NULL), last (NULL) {}
+	sortedView (const int *_first, const int *_last):
+		first (_first), last (_last) {}
+	sortedView (const std::vector<int> &list):
+		first (list. data ()), last (list. data () + list. size ()) {}
+
+	std::size_t size () const { return last - first; }
+	bool empty () const { return first == last; }
+	const int *begin () const { return first; }
+	const int *end () const { return last; }
+}; /* struct sortedView */
+
+// --------------------------------------------------
+// ------------------- set algebra ------------------
+// --------------------------------------------------
+
+/* x \in X or not, by the binary search */
+inline bool setContains(sortedView x,int n){
+  return std::binary_search(x.begin(),x.end(),n);
+}
+
+/* the first position in [p,last) not less than n; exponential then binary search */
+inline const int* gallop(const int* p,const int* last,int n){
+  std::size_t step = 1;
+  const int* q = p;
+  while (q < last && *q < n)
+    {
+      p = q + 1;
+      q = (last - q > static_cast<std::ptrdiff_t>(step)) ? q + step : last;
+      step <<= 1;
+    }
+  return std::lower_bound(p,q,n);
+}
+
+/* return the true when B is subset of A ; B<A */
+inline bool setIsSubset(sortedView a,sortedView b){
+  if (b.size() > a.size())
+    {
+      return false;
+    }
+  const int* p = a.begin();
+  if (b.size() * GALLOPRATIO < a.size())
+    {
+      for (auto n:b)
+        {
+          p = gallop(p,a.end(),n);
+          if (p == a.end() || *p != n)
+            {
+              return false;
+            }
+          ++p;
+        }
+      return true;
+    }
+  for (auto n:b)
+    {
+      while (p != a.end() && *p < n)
+        {
+          ++p;
+        }
+      if (p == a.end() || *p != n)
+        {
+          return false;
+        }
+      ++p;
+    }
+  return true;
+}
+
+/* elements of the short list found in the long one by galloping */
+inline void gallopIntersection(sortedView small,sortedView large,std::vector<int>& result){
+  const int* p = large.begin();
+  for (auto n:small)
+    {
+      p = gallop(p,large.end(),n);
+      if (p == large.end())
+        {
+          return;
+        }
+      if (*p == n)
+        {
+          result.push_back(n);
+        }
+    }
+}
+
+/* intersection by merging, starting at the given positions */
+inline void mergeIntersection(const int* i,const int* iend,const int* j,const int* jend,std::vector<int>& result){
+  while (i != iend && j != jend)
+    {
+      if (*i < *j)
+        {
+          ++i;
+        } else if (*j < *i)
+        {
+          ++j;
+        } else
+        {
+          result.push_back(*i);
+          ++i;
+          ++j;
+        }
+    }
+}
+
+#ifdef __SSE2__
+/*
+  intersection by blocks of four: a block of A is compared with all
+  rotations of a block of B, and the block with the smaller maximum
+  is passed. the rest is merged.
+*/
+inline void blockIntersection(sortedView a,sortedView b,std::vector<int>& result){
+  const int* i = a.begin();
+  const int* j = b.begin();
+  while (a.end() - i >= 4 && b.end() - j >= 4)
+    {
+      __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(i));
+      __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(j));
+      __m128i match = _mm_cmpeq_epi32(va,vb);
+      match = _mm_or_si128(match,_mm_cmpeq_epi32(va,_mm_shuffle_epi32(vb,_MM_SHUFFLE(0,3,2,1))));
+      match = _mm_or_si128(match,_mm_cmpeq_epi32(va,_mm_shuffle_epi32(vb,_MM_SHUFFLE(1,0,3,2))));
+      match = _mm_or_si128(match,_mm_cmpeq_epi32(va,_mm_shuffle_epi32(vb,_MM_SHUFFLE(2,1,0,3))));
+      int mask = _mm_movemask_ps(_mm_castsi128_ps(match));
+      for (int k = 0; k < 4; ++k)
+        {
+          if (mask >> k & 1)
+            {
+              result.push_back(i[k]);
+            }
+        }
+      int amax = i[3];
+      int bmax = j[3];
+      if (amax <= bmax)
+        {
+          i += 4;
+        }
+      if (bmax <= amax)
+        {
+          j += 4;
+        }
+    }
+  mergeIntersection(i,a.end(),j,b.end(),result);
+}
+#endif
+
+/* A \cap B, sorted */
+inline void setIntersection(sortedView a,sortedView b,std::vector<int>& result){
+  if (a.size() > b.size())
+    {
+      std::swap(a,b);
+    }
+  if (a.size() * GALLOPRATIO < b.size())
+    {
+      gallopIntersection(a,b,result);
+      return;
+    }
+#ifdef __SSE2__
+  if (a.size() >= 16)
+    {
+      blockIntersection(a,b,result);
+      return;
+    }
+#endif
+  mergeIntersection(a.begin(),a.end(),b.begin(),b.end(),result);
+}
+
+/* A \cup B, sorted */
+inline void setUnion(sortedView a,sortedView b,std::vector<int>& result){
+  result.reserve(result.size() + a.size() + b.size());
+  const int* i = a.begin();
+  const int* j = b.begin();
+  while (i != a.end() && j != b.end())
+    {
+      if (*i < *j)
+        {
+          result.push_back(*i++);
+        } else if (*j < *i)
+        {
+          result.push_back(*j++);
+        } else
+        {
+          result.push_back(*i++);
+          ++j;
+        }
+    }
+  result.insert(result.end(),i,a.end());
+  result.insert(result.end(),j,b.end());
+}
+
+/* inserts n keeping the list sorted; return false if n is already in it */
+inline bool setInsert(std::vector<int>& sorted,int n){
+  std::vector<int>::iterator it = std::lower_bound(sorted.begin(),sorted.end(),n);
+  if (it != sorted.end() && *it == n)
+    {
+      return false;
+    }
+  sorted.insert(it,n);
+  return true;
+}
+
+/* sorted copy of a list without repetitions */
+inline std::vector<int> sortedSet(const std::vector<int>& list){
+  std::vector<int> sorted = list;
+  std::sort(sorted.begin(),sorted.end());
+  sorted.erase(std::unique(sorted.begin(),sorted.end()),sorted.end());
+  return sorted;
+}
+
+#endif
@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// @file vertex_labels.h
+///
+/// This file contains the class vertexLabels, the correspondance between
+/// the integers which label the points in the data file and the dense
+/// identifiers 0, ..., n-1 which are used inside the program.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+// Copyright (C) 2026 by the contributors to posetHom
+//
+// This file is part of the posetHom program.  This is free software;
+// you can redistribute it and/or modify it under the terms of the GNU
+// General Public License as published by the Free Software Foundation;
+// either version 2 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this software; see the file "license.txt".  If not, write to the
+// Free Software Foundation, Inc., 59 Temple Place - Suite 330, Boston,
+// MA 02111-1307, USA.
+
+// Started in October 2026.
+
+#ifndef VERTEX_LABELS_H
+#define VERTEX_LABELS_H
+
+#include <vector>
+#include <array>
+#include <algorithm>
+
+class vertexLabels;
+
+// --------------------------------------------------
+// ------------------ vertexLabels ------------------
+// --------------------------------------------------
+
+/// The labels of the points read from a file. The i-th smallest label
+/// gets the identifier i, so the identifiers are ordered as the labels
+/// and the order of simpleces (see simplexOrder) does not change.
+/// An empty table is the identity, for data which is already dense;
+/// so are the labels 0, ..., n-1, which are found without a search.
+class vertexLabels
+{
+public:
+	/// The default constructor of the identity table.
+	vertexLabels ();
+
+	/// Collects the labels of the given arrows.
+	explicit vertexLabels (const std::vector<std::array<int,2>> &arrowList);
+
+	/// Collects the labels of the given simpleces.
+	explicit vertexLabels (const std::vector<std::vector<int>> &simpleces);
+
+	/// Collects the given labels, in any order and possibly repeated.
+	explicit vertexLabels (const std::vector<int> &points);
+
+	/// Returns the identifier of the label or -1 if not a point.
+	int id (int label) const;
+
+	/// Returns the label of the identifier.
+	int label (int id) const;
+
+	/// Returns the number of points (0 for the identity table).
+	int size () const;
+
+	/// Replaces the labels with the identifiers.
+	void toIds (std::vector<std::array<int,2>> &arrowList) const;
+	void toIds (std::vector<std::vector<int>> &simpleces) const;
+
+	/// Replaces the identifiers with the labels.
+	void toLabels (std::vector<int> &simplex) const;
+
+private:
+	/// The labels sorted in the ascending order.
+	std::vector<int> labels;
+
+	/// True if the labels are 0, ..., n-1, so a label is its identifier.
+	bool dense;
+
+	/// Sorts the labels and removes the repeated ones.
+	void normalize ();
+
+}; /* class vertexLabels */
+
+// --------------------------------------------------
+
+inline vertexLabels::vertexLabels (): dense (true)
+{
+	return;
+} /* vertexLabels::vertexLabels */
+
+inline vertexLabels::vertexLabels
+	(const std::vector<std::array<int,2>> &arrowList)
+{
+	for (const auto &a: arrowList)
+	{
+		labels. push_back (a [0]);
+		labels. push_back (a [1]);
+	}
+	normalize ();
+	return;
+} /* vertexLabels::vertexLabels */
+
+inline vertexLabels::vertexLabels
+	(const std::vector<std::vector<int>> &simpleces)
+{
+	for (const auto &s: simpleces)
+		labels. insert (labels. end (), s. begin (), s. end ());
+	normalize ();
+	return;
+} /* vertexLabels::vertexLabels */
+
+inline vertexLabels::vertexLabels (const std::vector<int> &points):
+	labels (points)
+{
+	normalize ();
+	return;
+} /* vertexLabels::vertexLabels */
+
+inline void vertexLabels::normalize ()
+{
+	std::sort (labels. begin (), labels. end ());
+	labels. erase (std::unique (labels. begin (), labels. end ()),
+		labels. end ());
+	int n = labels. size ();
+	dense = !n || (!labels. front () && (labels. back () == n - 1));
+	return;
+} /* vertexLabels::normalize */
+
+inline int vertexLabels::id (int l) const
+{
+	if (labels. empty ())
+		return l;
+	if (dense)
+		return ((l >= 0) && (l < static_cast<int> (labels. size ()))) ? l : -1;
+	std::vector<int>::const_iterator it =
+		std::lower_bound (labels. begin (), labels. end (), l);
+	if ((it == labels. end ()) || (*it != l))
+		return -1;
+	return it - labels. begin ();
+} /* vertexLabels::id */
+
+inline int vertexLabels::label (int i) const
+{
+	if (labels. empty ())
+		return i;
+	return labels [i];
+} /* vertexLabels::label */
+
+inline int vertexLabels::size () const
+{
+	return labels. size ();
+} /* vertexLabels::size */
+
+inline void vertexLabels::toIds (std::vector<std::array<int,2>> &arrowList)
+	const
+{
+	for (auto &a: arrowList)
+	{
+		a [0] = id (a [0]);
+		a [1] = id (a [1]);
+	}
+	return;
+} /* vertexLabels::toIds */
+
+inline void vertexLabels::toIds (std::vector<std::vector<int>> &simpleces)
+	const
+{
+	for (auto &s: simpleces)
+	{
+		for (auto &v: s)
+			v = id (v);
+	}
+	return;
+} /* vertexLabels::toIds */
+
+inline void vertexLabels::toLabels (std::vector<int> &simplex) const
+{
+	for (auto &v: simplex)
+		v = label (v);
+	return;
+} /* vertexLabels::toLabels */
+
+#endif
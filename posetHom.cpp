@@ -38,30 +38,128 @@ This is free software. No warranty. Consult 'license.txt' for details.";
 #include "include/Z2integer.h"
 #include "include/chain.h"
 #include "include/Z2matrix.h"
+#include "include/cw_complex.h"
+#include "include/morse_complex.h"
+#include "include/poset_structure.h"
+#include "include/poset_components.h"
+#include "include/poset_symmetry.h"
+#include "include/mayer_vietoris.h"
 int main(int argc,char *argv[])
 {
   std::cout << title << std::endl;
   std::cout <<  std::endl;
-  if (argc == 1){
+  /* --mod p: the homology with coefficients in Z_p (p = 2, 3, 5, 7) */
+  /* --fvector: only the f-vector of the order complex */
+  /* --core, --weak: remove the beat (and weak) points first; no whitney classes */
+  /* --cw: the cellular homology of a CW poset over Z_2; no generators */
+  /* --join: the homology from the parts if the poset is an ordinal sum (cones, suspensions); no generators */
+  /* --expr "a.txt * b.txt + c.txt": the homology of products (*) and joins (+) of posets from the files */
+  /* --components: over Z_2, reduce each connected component on its own, in parallel */
+  /* --morse: the homology over Z_2 of the Morse complex of a lexicographic matching; no generators */
+  /* --mv N: over Z_2, glue the homology of pieces of at most N maximal chains by the Mayer-Vietoris sequence; no generators */
+  /* --max-dim k: only H_0, ..., H_k, from the chains of at most k+2 points; no whitney classes if any is longer */
+  /* --symmetry: the automorphisms and the maximal chains up to them; over Z_2 and for odd order, only the invariant homology */
+  std::string filename;
+  int numFiles = 0;
+  int characteristic = 2;
+  bool fvector = false;
+  bool core = false;
+  bool weak = false;
+  bool cw = false;
+  bool morse = false;
+  bool join = false;
+  bool components = false;
+  bool symmetry = false;
+  std::uint64_t mayerVietorisLimit = 0;
+  int maxDim = -1;
+  std::string expression;
+  for (int i = 1; i < argc; ++i)
+    {
+      std::string arg = argv[i];
+      if (arg == "--mod" && i+1 < argc)
+        {
+          characteristic = std::atoi(argv[++i]);
+        } else if (arg == "--fvector")
+        {
+          fvector = true;
+        } else if (arg == "--cw")
+        {
+          cw = true;
+        } else if (arg == "--join")
+        {
+          join = true;
+        } else if (arg == "--expr" && i+1 < argc)
+        {
+          /* the expression takes the place of the file name */
+          expression = argv[++i];
+          numFiles += 1;
+        } else if (arg == "--components")
+        {
+          components = true;
+        } else if (arg == "--morse")
+        {
+          morse = true;
+        } else if (arg == "--mv" && i+1 < argc)
+        {
+          mayerVietorisLimit = std::strtoull(argv[++i],NULL,10);
+        } else if (arg == "--max-dim" && i+1 < argc)
+        {
+          maxDim = std::atoi(argv[++i]);
+        } else if (arg == "--symmetry")
+        {
+          symmetry = true;
+        } else if (arg == "--core")
+        {
+          core = true;
+        } else if (arg == "--weak")
+        {
+          core = true;
+          weak = true;
+        } else {
+        filename = arg;
+        numFiles += 1;
+      }
+    }
+  if (numFiles == 0){
     std::cout << "argument is missing. The number of argument should be only one: text file name." << std::endl;
     return 0;
   }
-  if (argc > 2)
+  if (numFiles > 1)
     {
       std::cout << "Too many argument.The number of argument should be only one: text file name." << std::endl;
       return 0;
     }
-  std::string filename = argv[1];
+  if (characteristic != 2 && characteristic != 3 && characteristic != 5 && characteristic != 7)
+    {
+      std::cerr << characteristic << ": unsupported modulus, please use 2, 3, 5 or 7." << std::endl;
+      return 0;
+    }
+  if (!expression.empty())
+    {
+      showExpressionHomology(expression,characteristic);
+      return 0;
+    }
   bool valid = isDataValid(filename);
   if (!valid){
     std::cerr << filename << ": Invalid Data, please check its content." << std::endl;
     return 0;
   }
+  if (fvector)
+    {
+      std::vector<std::array<int,2>> arrows;
+      makeArrowList(filename,arrows);
+      vertexLabels(arrows).toIds(arrows);
+      showFVector(fVector(orderIndex(HasseDiagram(arrows,arrows.size()))));
+      return 0;
+    }
   bool euler = isEuler(filename);
   int numArrow = numberOfArrow(filename);
   std::vector<std::array<int,2>> arrowList;
   // int arrowList[numArrow][2];
   makeArrowList(filename,arrowList);
+  /* points are handled by dense identifiers; the labels are used only for output */
+  vertexLabels labels(arrowList);
+  labels.toIds(arrowList);
   std::vector<int> vertexList;
   vertexSet(arrowList,numArrow,vertexList);
   if (euler)
@@ -69,12 +167,124 @@ int main(int argc,char *argv[])
       std::cout << "The poset is Euler! " << std::endl;
     }
 
-  std::vector<std::vector<int>> maximalChains;
+  /* the invariant homology takes the place of the whole one, only over Z_2 */
+  if (symmetry && showSymmetry(HasseDiagram(arrowList,numArrow),characteristic == 2))
+    {
+      return 0;
+    }
+
+  if (cw)
+    {
+      if (characteristic != 2)
+        {
+          std::cerr << "--cw is only for Z_2; the order complex is used." << std::endl;
+        } else if (showCellularHomology(HasseDiagram(arrowList,numArrow)))
+        {
+          return 0;
+        } else {
+        std::cerr << filename << ": not a CW poset; the order complex is used." << std::endl;
+      }
+    }
+
+  if (join)
+    {
+      if (showJoinHomology(HasseDiagram(arrowList,numArrow),characteristic))
+        {
+          return 0;
+        }
+      std::cerr << filename << ": not a join of smaller posets; the order complex is used." << std::endl;
+    }
+
+  if (components)
+    {
+      if (characteristic != 2 || core || maxDim >= 0)
+        {
+          std::cerr << "--components is only for Z_2 without --core and --max-dim; the whole poset is used." << std::endl;
+        } else if (showComponentHomology(arrowList,vertexList.size(),euler,labels))
+        {
+          return 0;
+        }
+    }
+
+  if (mayerVietorisLimit > 0)
+    {
+      if (characteristic != 2 || core)
+        {
+          std::cerr << "--mv is only for Z_2 without --core; the whole complex is used." << std::endl;
+        } else {
+        showMayerVietorisHomology(HasseDiagram(arrowList,numArrow),mayerVietorisLimit);
+        return 0;
+      }
+    }
 
-  maximalChains = getMaximalChains(filename);
   std::vector<std::vector<int>> simpleces;
+  /* the number of the dimensions shown; 0: all of them */
+  int topdim = 0;
 
-  simpleces = getChainComplexGenerators(maximalChains);
+  if (maxDim >= 0)
+    {
+      /* only the chains of at most maxDim+2 points, the (maxDim+1)-skeleton */
+      HasseDiagram hasse(arrowList,numArrow);
+      orderIndex order(hasse);
+      std::vector<std::uint64_t> alive(order.words(),0);
+      for (int v = 0; v < hasse.size(); ++v)
+        {
+          alive[v >> 6] |= (std::uint64_t) 1 << (v & 63);
+        }
+      if (core)
+        {
+          alive = corePoints(order,weak);
+          int corePointNum = 0;
+          for (auto word:alive)
+            {
+              corePointNum += __builtin_popcountll(word);
+            }
+          std::cout << "The reduced poset has " << corePointNum << " of " << vertexList.size() << " points." << std::endl;
+        }
+      bool truncated = false;
+      simpleces = boundedChains(order,maxDim + 2,alive,truncated);
+      if (truncated)
+        {
+          topdim = maxDim + 1;
+          std::cout << "The homology is computed up to H_" << maxDim << " from the " << maxDim + 1 << "-skeleton." << std::endl;
+        }
+    } else if (core)
+    {
+      /* the points of the reduced poset keep their identifiers, so the labels still apply */
+      int corePointNum = 0;
+      simpleces = getChainComplexGenerators(coreMaximalChains(HasseDiagram(arrowList,numArrow),weak,corePointNum));
+      std::cout << "The reduced poset has " << corePointNum << " of " << vertexList.size() << " points." << std::endl;
+    } else {
+    /* the faces are read from the chain table, which is freed right after */
+    simpleces = getChainComplexGenerators(getMaximalChains(filename,labels));
+  }
+
+  if (morse)
+    {
+      if (characteristic != 2)
+        {
+          std::cerr << "--morse is only for Z_2; the whole complex is used." << std::endl;
+        } else {
+        /* match the chains by the points from the bottom up, a linear extension of the order */
+        HasseDiagram hasse(arrowList,numArrow);
+        std::vector<int> vertexOrder;
+        for (auto v:ascendingOrder(orderIndex(hasse)))
+          {
+            vertexOrder.push_back(hasse.label(v));
+          }
+        morseComplex matching(simpleces);
+        matching.matchByVertices(vertexOrder);
+        showMorseHomology(matching,simpleces,topdim);
+        return 0;
+      }
+    }
+
+  /* the whitney classes are defined only over Z_2 */
+  if (characteristic != 2)
+    {
+      showHomologyModP(characteristic,simpleces,labels,topdim);
+      return 0;
+    }
 
   Z2matrix boundary = Z2matrix();
   boundary = makeBoundaryMatrix(simpleces);
@@ -96,31 +306,35 @@ int main(int argc,char *argv[])
   // std::cout << "basechange" << std::endl;
   // showAsMatrix(v);
 
-  showHomology(boundary,simpleces);
+  showHomology(boundary,simpleces,topdim);
   std::vector<int> generatorIndexList = {};
-  showHomologyGenerator(boundary,v,simpleces,generatorIndexList);
+  showHomologyGenerator(boundary,v,simpleces,generatorIndexList,labels,topdim);
 
-  Z2matrix inv = v;
-  inv.invert();
+  if(euler && core){
+    std::cout << "The whitney classes are not computed for the reduced poset." << std::endl;
+  }
+  if(euler && !core && topdim > 0){
+    std::cout << "The whitney classes are not computed for a skeleton." << std::endl;
+  }
+  if(euler && !core && topdim == 0){
+    /* the change of basis is inverted only for the whitney classes */
+    Z2matrix inv = v;
+    inv.invert();
 
-  Z2matrix image = Z2matrix();
-  image.multiply(inv,boundary);
-  // std::cout << "image" << std::endl;
-  // showAsMatrix(image);
+    Z2matrix image = Z2matrix();
+    image.multiply(inv,boundary);
+    // std::cout << "image" << std::endl;
+    // showAsMatrix(image);
 
-  if(euler){
-    chain whitneyChianBefore = chain();
-    for (int i = 0; i < dimention(simpleces); ++i)
-      {
-        whitneyChianBefore.add(makeWhitneyChain(i,simpleces,vertexList,arrowList,numArrow));
-      }
+    /* all the dimensions in one pass */
+    Z2chain whitneyChianBefore = makeWhitneyChain(simpleces,arrowList,numArrow);
 
     Z2matrix c = Z2matrix();
     c = action(inv,whitneyChianBefore);
-    chain whitneyChainAfter = c.getcol(0);
+    Z2chain whitneyChainAfter = c.getcol(0);
 
     detectWhitneyClass(whitneyChainAfter, image,generatorIndexList);
-    std::vector<chain> whitneyGeneratorList = {};
+    std::vector<Z2chain> whitneyGeneratorList = {};
     showWhitneyClass(whitneyChainAfter,simpleces,generatorIndexList);
     std::cout << std::endl;
   }
@@ -38,21 +38,50 @@ This is free software. No warranty. Consult 'license.txt' for details.";
 #include "include/Z2integer.h"
 #include "include/chain.h"
 #include "include/Z2matrix.h"
+#include "include/morse_complex.h"
 int main(int argc,char *argv[])
 {
   std::cout << title << std::endl;
   std::cout <<  std::endl;
-  if (argc == 1){
+  /* --mod p: the homology with coefficients in Z_p (p = 2, 3, 5, 7) */
+  /* --morse: reduce to the Morse complex of a collapse sequence over Z_2 first */
+  /* --coreduce: the same with a coreduction sequence */
+  std::string filename;
+  int numFiles = 0;
+  int characteristic = 2;
+  bool morse = false;
+  bool coreduce = false;
+  for (int i = 1; i < argc; ++i)
+    {
+      std::string arg = argv[i];
+      if (arg == "--mod" && i+1 < argc)
+        {
+          characteristic = std::atoi(argv[++i]);
+        } else if (arg == "--morse")
+        {
+          morse = true;
+        } else if (arg == "--coreduce")
+        {
+          coreduce = true;
+        } else {
+        filename = arg;
+        numFiles += 1;
+      }
+    }
+  if (numFiles == 0){
     std::cout << "argument is missing. The number of argument should be only one: text file name." << std::endl;
     return 0;
   }
-  if (argc > 2)
+  if (numFiles > 1)
     {
       std::cout << "Too many argument.The number of argument should be only one: text file name." << std::endl;
       return 0;
     }
-
-  std::string filename = argv[1];
+  if (characteristic != 2 && characteristic != 3 && characteristic != 5 && characteristic != 7)
+    {
+      std::cerr << characteristic << ": unsupported modulus, please use 2, 3, 5 or 7." << std::endl;
+      return 0;
+    }
 
 
 
@@ -67,7 +96,9 @@ int main(int argc,char *argv[])
 
   // maximalChains(maximalSimplex) is obteined directly from the data.
 
-  std::vector<std::vector<int>> maximalSimplexList = getMaximalSimplex(filename);
+  /* vertrices are handled by dense identifiers; the labels are used only for output */
+  vertexLabels labels;
+  std::vector<std::vector<int>> maximalSimplexList = getMaximalSimplex(filename,labels);
   std::vector<std::vector<int>> simpleces;
 
   simpleces = getChainComplexGenerators(maximalSimplexList);
@@ -89,6 +120,55 @@ int main(int argc,char *argv[])
     std::cout << "This is NOT Euler. " << std::endl;
   }
 
+  if (morse || coreduce)
+    {
+      if (characteristic != 2)
+        {
+          std::cerr << (coreduce ? "--coreduce" : "--morse") << " is only for Z_2; the whole complex is used." << std::endl;
+        } else {
+        /* the same steps as below on the critical simpleces; the generators are lifted back to simpleces */
+        morseComplex matching(simpleces);
+        if (coreduce)
+          {
+            matching.matchByCoreductions();
+          } else {
+          matching.matchByCollapses();
+        }
+        std::cout << "The Morse complex has " << matching.criticalNum() << " of " << matching.size() << " simpleces." << std::endl;
+        std::vector<int> critical = matching.criticalList();
+        std::vector<std::vector<int>> cells = morseCells(simpleces,critical);
+        Z2matrix boundary = matching.boundaryMatrix(critical);
+        Z2matrix v = Z2matrix();
+        v.identity(boundary.getncols());
+        boundary.reduceBoundary(boundary,v);
+        showHomology(boundary,cells,dimention(simpleces));
+        std::vector<int> generatorIndexList = {};
+        showMorseHomologyGenerator(matching,boundary,v,simpleces,critical,generatorIndexList,labels);
+        if (euler)
+          {
+            Z2matrix inv = v;
+            inv.invert();
+            Z2matrix image = Z2matrix();
+            image.multiply(inv,boundary);
+            Z2chain whitneyChianBefore = morseChain(matching,makeWhitneyChain(simpleces,arrowList,numberOfArrows),critical);
+            Z2matrix c = Z2matrix();
+            c = action(inv,whitneyChianBefore);
+            Z2chain whitneyChainAfter = c.getcol(0);
+            detectWhitneyClass(whitneyChainAfter,image,generatorIndexList);
+            showWhitneyClass(whitneyChainAfter,cells,generatorIndexList,dimention(simpleces));
+            std::cout << std::endl;
+          }
+        return 0;
+      }
+    }
+
+
+  /* the whitney classes are defined only over Z_2 */
+  if (characteristic != 2)
+    {
+      showHomologyModP(characteristic,simpleces,labels);
+      return 0;
+    }
 
   Z2matrix boundary = Z2matrix();
   boundary = makeBoundaryMatrix(simpleces);
@@ -112,7 +192,7 @@ int main(int argc,char *argv[])
 
   showHomology(boundary,simpleces);
   std::vector<int> generatorIndexList = {};
-  showHomologyGenerator(boundary,v,simpleces,generatorIndexList);
+  showHomologyGenerator(boundary,v,simpleces,generatorIndexList,labels);
 
   Z2matrix inv = v;
   inv.invert();
@@ -123,18 +203,15 @@ int main(int argc,char *argv[])
   // showAsMatrix(image);
 
   if(euler){
-    chain whitneyChianBefore = chain();
-    for (int i = 0; i < dimention(simpleces); ++i)
-      {
-        whitneyChianBefore.add(makeWhitneyChain(i,simpleces,vertexList,arrowList,numberOfArrows));
-      }
+    /* all the dimensions in one pass */
+    Z2chain whitneyChianBefore = makeWhitneyChain(simpleces,arrowList,numberOfArrows);
 
     Z2matrix c = Z2matrix();
     c = action(inv,whitneyChianBefore);
-    chain whitneyChainAfter = c.getcol(0);
+    Z2chain whitneyChainAfter = c.getcol(0);
 
     detectWhitneyClass(whitneyChainAfter, image,generatorIndexList);
-    std::vector<chain> whitneyGeneratorList = {};
+    std::vector<Z2chain> whitneyGeneratorList = {};
     showWhitneyClass(whitneyChainAfter,simpleces,generatorIndexList);
     std::cout << std::endl;
   }